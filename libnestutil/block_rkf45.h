@@ -0,0 +1,280 @@
+/*
+ *  block_rkf45.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BLOCK_RKF45_H
+#define BLOCK_RKF45_H
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Embedded Runge-Kutta-Fehlberg 4(5) integrator for a block of independent
+ * systems of the same form.
+ *
+ * The systems, called lanes, are advanced in lockstep: each stage of the
+ * method is computed for all lanes in loops over the lanes, which the
+ * compiler can vectorize. Each lane has its own time, step size and error
+ * tolerance. Lanes that have reached the end of the interval or whose step
+ * has been accepted take steps of size zero until all lanes are done.
+ *
+ * The method, error estimate and step size control are those of
+ * gsl_odeiv_step_rkf45 driven by gsl_odeiv_evolve_apply with the control
+ * gsl_odeiv_control_yp_new( tol, tol ), so that the tolerance has the same
+ * meaning as gsl_error_tol in the models that use GSL.
+ *
+ * The state of lane l is given by y[ k ][ l ] for the components
+ * k = 0, ..., dim - 1. The dynamics are given by a functor called as
+ * f( y, dydt, n ) with const double* const y[ dim ] and
+ * double* const dydt[ dim ], which computes the derivatives of lanes [0, n).
+ * The derivatives must not depend on time.
+ */
+template < size_t dim >
+class BlockRKF45
+{
+public:
+  //! Create an integrator for up to max_lanes lanes
+  explicit BlockRKF45( const size_t max_lanes );
+
+  /**
+   * Make one accepted step for every lane l < n with t[ l ] < t_end.
+   *
+   * The step of lane l is h[ l ] or the remainder t_end - t[ l ], whichever
+   * is smaller, and is repeated with a smaller step until its error is
+   * within tolerance. On return, t[ l ] and y[ . ][ l ] are advanced and
+   * h[ l ] holds the step size suggested for the next step.
+   */
+  template < typename Dynamics >
+  void apply( Dynamics& f,
+    const size_t n,
+    const double t_end,
+    double* t,
+    double* h,
+    const double* tol,
+    double* const y[ dim ] );
+
+private:
+  static const size_t num_stages_ = 6;
+
+  double*
+  scratch_( const size_t s, const size_t k )
+  {
+    return &scratch_data_[ ( s * dim + k ) * max_lanes_ ];
+  }
+
+  //! Set ynew = y + h * sum_s a[ s ] * k_s for the first num_a stages
+  void combine_( const size_t n, const double* const y[ dim ], const double* a, const size_t num_a, double* const ynew[] );
+
+  const size_t max_lanes_;
+
+  //! stages k_1, ..., k_6, the derivative at the new point and the new point
+  std::vector< double > scratch_data_;
+
+  //! step attempted in the current iteration, zero for lanes that are done
+  std::vector< double > h0_;
+  std::vector< unsigned char > pending_;
+};
+
+template < size_t dim >
+BlockRKF45< dim >::BlockRKF45( const size_t max_lanes )
+  : max_lanes_( max_lanes )
+  , scratch_data_( ( num_stages_ + 2 ) * dim * max_lanes )
+  , h0_( max_lanes )
+  , pending_( max_lanes )
+{
+}
+
+template < size_t dim >
+void
+BlockRKF45< dim >::combine_( const size_t n,
+  const double* const y[ dim ],
+  const double* a,
+  const size_t num_a,
+  double* const ynew[] )
+{
+  const double* const h0 = &h0_[ 0 ];
+  for ( size_t k = 0; k < dim; ++k )
+  {
+    const double* const yk = y[ k ];
+    double* const ynewk = ynew[ k ];
+#pragma omp simd
+    for ( size_t l = 0; l < n; ++l )
+    {
+      ynewk[ l ] = 0.;
+    }
+    for ( size_t s = 0; s < num_a; ++s )
+    {
+      if ( a[ s ] == 0. )
+      {
+        continue;
+      }
+      const double as = a[ s ];
+      const double* const ks = scratch_( s, k );
+#pragma omp simd
+      for ( size_t l = 0; l < n; ++l )
+      {
+        ynewk[ l ] += as * ks[ l ];
+      }
+    }
+#pragma omp simd
+    for ( size_t l = 0; l < n; ++l )
+    {
+      ynewk[ l ] = yk[ l ] + h0[ l ] * ynewk[ l ];
+    }
+  }
+}
+
+template < size_t dim >
+template < typename Dynamics >
+void
+BlockRKF45< dim >::apply( Dynamics& f,
+  const size_t n,
+  const double t_end,
+  double* t,
+  double* h,
+  const double* tol,
+  double* const y[ dim ] )
+{
+  // Butcher tableau of the Fehlberg method, as in GSL's rkf45.c
+  static const double a2[] = { 1.0 / 4.0 };
+  static const double a3[] = { 3.0 / 32.0, 9.0 / 32.0 };
+  static const double a4[] = { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 };
+  static const double a5[] = { 8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0 };
+  static const double a6[] = {
+    -6080.0 / 20520.0, 41040.0 / 20520.0, -28352.0 / 20520.0, 9295.0 / 20520.0, -5643.0 / 20520.0
+  };
+  static const double* const a[] = { a2, a3, a4, a5, a6 };
+
+  // fifth-order weights and error coefficients
+  static const double c[] = { 902880.0 / 7618050.0,
+    0.0,
+    3953664.0 / 7618050.0,
+    3855735.0 / 7618050.0,
+    -1371249.0 / 7618050.0,
+    277020.0 / 7618050.0 };
+  static const double ec[] = { 1.0 / 360.0, 0.0, -128.0 / 4275.0, -2197.0 / 75240.0, 1.0 / 50.0, 2.0 / 55.0 };
+
+  // parameters of the standard GSL control with order 5
+  const double safety = 0.9;
+  const double order = 5.0;
+
+  double* ytmp[ dim ];
+  double* dydt_out[ dim ];
+  double* stage[ num_stages_ ][ dim ];
+  for ( size_t k = 0; k < dim; ++k )
+  {
+    for ( size_t s = 0; s < num_stages_; ++s )
+    {
+      stage[ s ][ k ] = scratch_( s, k );
+    }
+    dydt_out[ k ] = scratch_( num_stages_, k );
+    ytmp[ k ] = scratch_( num_stages_ + 1, k );
+  }
+
+  size_t num_pending = 0;
+  for ( size_t l = 0; l < n; ++l )
+  {
+    pending_[ l ] = t[ l ] < t_end;
+    num_pending += pending_[ l ];
+  }
+
+  // the derivative at the initial point is used for all attempts
+  f( y, stage[ 0 ], n );
+
+  while ( num_pending > 0 )
+  {
+    for ( size_t l = 0; l < n; ++l )
+    {
+      h0_[ l ] = pending_[ l ] ? std::min( h[ l ], t_end - t[ l ] ) : 0.;
+    }
+
+    for ( size_t s = 1; s < num_stages_; ++s )
+    {
+      combine_( n, y, a[ s - 1 ], s, ytmp );
+      f( ytmp, stage[ s ], n );
+    }
+    combine_( n, y, c, num_stages_, ytmp );
+    f( ytmp, dydt_out, n );
+
+    for ( size_t l = 0; l < n; ++l )
+    {
+      if ( not pending_[ l ] )
+      {
+        continue;
+      }
+
+      // error relative to tol + tol * | h y' |, maximized over the components
+      double rmax = 0.;
+      for ( size_t k = 0; k < dim; ++k )
+      {
+        double err = 0.;
+        for ( size_t s = 0; s < num_stages_; ++s )
+        {
+          err += ec[ s ] * stage[ s ][ k ][ l ];
+        }
+        const double D0 = tol[ l ] * std::abs( h0_[ l ] * dydt_out[ k ][ l ] ) + tol[ l ];
+        rmax = std::max( std::abs( h0_[ l ] * err ) / D0, rmax );
+      }
+
+      // As in gsl_odeiv_evolve_apply(), the time is advanced before the step
+      // size is adjusted, and a step is only rejected if the reduced step
+      // still changes the advanced time t_curr.
+      const bool final_step = h[ l ] > t_end - t[ l ];
+      const double t_curr = final_step ? t_end : t[ l ] + h0_[ l ];
+      double h_new = h0_[ l ];
+      if ( rmax > 1.1 )
+      {
+        h_new *= std::max( safety / std::pow( rmax, 1.0 / order ), 0.2 );
+        const double t_next = t_curr + h_new;
+        if ( h_new < h0_[ l ] and t_next != t_curr )
+        {
+          // reject the step and try again with the reduced step size
+          h[ l ] = h_new;
+          continue;
+        }
+        h_new = h0_[ l ];
+      }
+      else if ( rmax < 0.5 )
+      {
+        h_new *= std::min( std::max( safety / std::pow( rmax, 1.0 / ( order + 1.0 ) ), 1.0 ), 5.0 );
+      }
+
+      for ( size_t k = 0; k < dim; ++k )
+      {
+        y[ k ][ l ] = ytmp[ k ][ l ];
+      }
+      t[ l ] = t_curr;
+      h[ l ] = h_new;
+      pending_[ l ] = false;
+      --num_pending;
+    }
+  }
+}
+
+} // namespace nest
+
+#endif /* #ifndef BLOCK_RKF45_H */
@@ -88,6 +88,69 @@ const double numerics::nan = NAN;
 const double numerics::nan = 0.0 / 0.0;
 #endif
 
+// 2^( j / 128 ), printed with 17 significant digits to round-trip exactly
+const double numerics::fast_exp_table[ numerics::fast_exp_table_size ] = {
+  1.0, 1.0054299011128027, 1.0108892860517005, 1.0163783149109531,
+  1.0218971486541166, 1.0274459491187637, 1.0330248790212284, 1.0386341019613787,
+  1.0442737824274138, 1.0499440858006872, 1.0556451783605572, 1.0613772272892621,
+  1.0671404006768237, 1.0729348675259756, 1.0787607977571199, 1.0846183622133092,
+  1.0905077326652577, 1.0964290818163769, 1.1023825833078409, 1.1083684117236787,
+  1.1143867425958924, 1.1204377524096067, 1.1265216186082418, 1.1326385195987192,
+  1.1387886347566916, 1.1449721444318042, 1.1511892299529827, 1.1574400736337511,
+  1.1637248587775775, 1.1700437696832502, 1.1763969916502812, 1.182784710984341,
+  1.189207115002721, 1.1956643920398273, 1.2021567314527031, 1.2086843236265816,
+  1.215247359980469, 1.2218460329727576, 1.22848053610687, 1.2351510639369334,
+  1.241857812073484, 1.2486009771892048, 1.2553807570246911, 1.2621973503942507,
+  1.2690509571917332, 1.275941778396392, 1.2828700160787783, 1.2898358734066657,
+  1.2968395546510096, 1.3038812651919358, 1.3109612115247644, 1.318079601266064,
+  1.3252366431597413, 1.3324325470831615, 1.3396675240533029, 1.3469417862329458,
+  1.3542555469368927, 1.3616090206382248, 1.3690024229745905, 1.3764359707545302,
+  1.383909881963832, 1.3914243757719262, 1.3989796725383112, 1.4065759938190154,
+  1.4142135623730951, 1.4218926021691656, 1.42961333839197, 1.4373759974489824,
+  1.4451808069770467, 1.4530279958490526, 1.460917794180647, 1.4688504333369818,
+  1.4768261459394993, 1.4848451658727524, 1.4929077282912648, 1.5010140696264256,
+  1.5091644275934228, 1.5173590411982147, 1.5255981507445384, 1.5338819978409559,
+  1.5422108254079407, 1.550584877685, 1.5590044002378369, 1.567469639965553,
+  1.5759808451078865, 1.5845382652524937, 1.593142151342267, 1.6017927556826934,
+  1.6104903319492543, 1.6192351351948637, 1.6280274218573478, 1.6368674497669644,
+  1.6457554781539649, 1.6546917676561943, 1.6636765803267364, 1.6727101796415966,
+  1.681792830507429, 1.6909247992693053, 1.7001063537185235, 1.7093377631004629,
+  1.7186192981224779, 1.7279512309618377, 1.7373338352737062, 1.746767386199169,
+  1.7562521603732995, 1.7657884359332727, 1.7753764925265212, 1.785016611318935,
+  1.7947090750031072, 1.8044541678066239, 1.8142521755003989, 1.8241033854070534,
+  1.8340080864093424, 1.843966568958626, 1.8539791250833855, 1.864046048397789,
+  1.8741676341103, 1.8843441790323345, 1.8945759815869656, 1.9048633418176741,
+  1.9152065613971474, 1.925605943636125, 1.9360617934922943, 1.9465744175792332,
+  1.9571441241754002, 1.9677712232331759, 1.9784560263879509, 1.9891988469672663
+};
+
+const size_t numerics::ExpDecayTable::max_size;
+
+numerics::ExpDecayTable::ExpDecayTable()
+  : h_( 1.0 )
+  , inv_h_( 1.0 )
+  , inv_tau_( 1.0 )
+  , eps_( 0.0 )
+  , size_( 0.0 )
+  , values_()
+{
+}
+
+void
+numerics::ExpDecayTable::set( const double tau, const double h )
+{
+  h_ = h;
+  inv_h_ = 1.0 / h;
+  inv_tau_ = 1.0 / tau;
+  eps_ = 1e-6 * h;
+  values_.resize( std::min( static_cast< size_t >( std::ceil( 4.0 * tau / h ) ) + 1, max_size ) );
+  for ( size_t k = 0; k < values_.size(); ++k )
+  {
+    values_[ k ] = std::exp( -( k * h ) / tau );
+  }
+  size_ = values_.size();
+}
+
 // later also in namespace
 long
 ld_round( double x )
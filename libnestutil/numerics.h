@@ -27,9 +27,13 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <vector>
 
 #if HAVE_EXPM1
 #include <math.h>
@@ -85,6 +89,166 @@ expm1( double x )
 #endif
 }
 
+//! Number of entries of fast_exp_table, a power of two
+const int fast_exp_table_size = 128;
+
+//! 2^( j / fast_exp_table_size ) for j = 0, ..., fast_exp_table_size - 1
+extern const double fast_exp_table[ fast_exp_table_size ];
+
+//! 1 / n!, evaluated at compile time
+constexpr double
+inv_factorial( const unsigned int n )
+{
+  return n == 0 ? 1.0 : inv_factorial( n - 1 ) / n;
+}
+
+/**
+ * Taylor polynomial sum_{m=n}^{degree} r^(m-n) / m! of the exponential
+ * function, evaluated by the Horner scheme with coefficients computed at
+ * compile time.
+ */
+template < unsigned int n, unsigned int degree >
+struct ExpTaylor
+{
+  static double
+  eval( const double r )
+  {
+    return inv_factorial( n ) + r * ExpTaylor< n + 1, degree >::eval( r );
+  }
+};
+
+template < unsigned int degree >
+struct ExpTaylor< degree, degree >
+{
+  static double
+  eval( const double )
+  {
+    return inv_factorial( degree );
+  }
+};
+
+/**
+ * Exponential function for use in inner loops.
+ *
+ * The argument is split into x = ( k + j / N ) ln 2 + r with integer k, the
+ * table index j and |r| <= ln 2 / ( 2 N ), N = fast_exp_table_size. The
+ * result is 2^k * 2^( j / N ) * exp( r ), with exp( r ) approximated by a
+ * Taylor polynomial of the given degree. The function is inline and free of
+ * calls and data-dependent branches, so that compilers can vectorize loops
+ * calling it.
+ *
+ * The degree sets the accuracy. Compared to std::exp, the error is at most
+ * 2 ulp for degree 5 (the default), 16 ulp for degree 4 and 2^15 ulp for
+ * degree 3. Results smaller than the smallest normal double are flushed to
+ * zero.
+ */
+template < unsigned int degree = 5 >
+inline double
+fast_exp( const double x )
+{
+  const double x_min = -708.39641853226410622; // log of smallest normal double
+  const double x_max = 709.78271289338399678;  // log of largest double
+  const double N_log2e = fast_exp_table_size * 1.4426950408889634074;
+  // ln 2 / N split into a part with trailing zero bits, so that k * ln2_hi_N is exact, and the rest
+  const double ln2_hi_N = 6.93147180369123816490e-01 / fast_exp_table_size;
+  const double ln2_lo_N = 1.90821492927058770002e-10 / fast_exp_table_size;
+  // adding and subtracting 1.5 * 2^52 rounds to the nearest integer
+  const double round_shift = 6755399441055744.0;
+
+  const double xc = std::min( std::max( x == x ? x : 0.0, x_min ), x_max );
+  const double kd = ( xc * N_log2e + round_shift ) - round_shift;
+  const double r = ( xc - kd * ln2_hi_N ) - kd * ln2_lo_N;
+  const int64_t k = static_cast< int64_t >( kd );
+  const double p = ExpTaylor< 0, degree >::eval( r ) * fast_exp_table[ k & ( fast_exp_table_size - 1 ) ];
+
+  // 2^e in two factors, as 2^e for e = 1024 is not a normal double
+  const int64_t e = k >> 7; // floor( k / fast_exp_table_size )
+  const int64_t e1 = e >> 1;
+  const uint64_t bits1 = static_cast< uint64_t >( e1 + 1023 ) << 52;
+  const uint64_t bits2 = static_cast< uint64_t >( e - e1 + 1023 ) << 52;
+  double scale1;
+  double scale2;
+  std::memcpy( &scale1, &bits1, sizeof( double ) );
+  std::memcpy( &scale2, &bits2, sizeof( double ) );
+  const double result = p * scale1 * scale2;
+
+  if ( not( x == x ) )
+  {
+    return x;
+  }
+  return x < x_min ? 0.0 : ( x > x_max ? std::numeric_limits< double >::infinity() : result );
+}
+
+/**
+ * exp( x ) - 1 for use in inner loops, see fast_exp().
+ *
+ * For |x| < ln 2 / 2, the Taylor series without the constant term is summed
+ * up to degree 2 * degree + 2, which avoids the cancellation in
+ * fast_exp( x ) - 1. Compared to expm1(), the error is at most 8 ulp for
+ * degree 5.
+ */
+template < unsigned int degree = 5 >
+inline double
+fast_expm1( const double x )
+{
+  const double small = x * ExpTaylor< 1, 2 * degree + 2 >::eval( x );
+  return std::abs( x ) < 0.34657359027997264 ? small : fast_exp< degree >( x ) - 1.0;
+}
+
+/**
+ * fast_exp( x ) if fast is set and std::exp( x ) otherwise.
+ *
+ * Callers read the setting once, e.g. per spike, so that the choice is a
+ * well-predicted branch on a local value.
+ */
+inline double
+select_exp( const double x, const bool fast )
+{
+  return fast ? fast_exp( x ) : std::exp( x );
+}
+
+/**
+ * Table of exp( -t / tau ) for time differences t that are multiples of the
+ * resolution h.
+ *
+ * Plasticity rules whose time constant is shared by all their synapses keep
+ * one table per time constant. The table covers t up to four time
+ * constants with at most max_size entries. Time differences that are off
+ * the grid by more than a millionth of h or beyond the table, such as those
+ * of precise spikes, are computed by fast_exp().
+ */
+class ExpDecayTable
+{
+public:
+  //! Maximum number of entries, so that the table fits into the L1 cache
+  static const size_t max_size = 1024;
+
+  ExpDecayTable();
+
+  //! Tabulate exp( -k h / tau ) for k = 0, 1, ...
+  void set( const double tau, const double h );
+
+  //! exp( t / tau ) for t <= 0
+  double
+  operator()( const double t ) const
+  {
+    const double k = std::round( -t * inv_h_ );
+    if ( k >= 0. and k < size_ and std::abs( t + k * h_ ) <= eps_ )
+    {
+      return values_[ static_cast< size_t >( k ) ];
+    }
+    return fast_exp( t * inv_tau_ );
+  }
+
+private:
+  double h_;
+  double inv_h_;
+  double inv_tau_;
+  double eps_;
+  double size_; //!< Number of entries, as double for the comparison with k
+  std::vector< double > values_;
+};
+
 template < typename T >
 bool
 is_nan( T f )
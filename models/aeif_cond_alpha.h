@@ -33,11 +33,15 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_odeiv.h>
 
+// Includes from libnestutil:
+#include "block_rkf45.h"
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -84,6 +88,9 @@ Synaptic conductances are modelled as alpha-functions.
 
 This implementation uses the embedded 4th order Runge-Kutta-Fehlberg solver with
 adaptive step size to integrate the differential equation.
+If the kernel property ``vectorized_update`` is set, neurons of this model
+are integrated in blocks by a built-in implementation of the same solver with
+the same step size control instead of GSL.
 
 The membrane potential is given by the following differential equation:
 
@@ -221,6 +228,9 @@ private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  bool supports_batch_update() const;
+  NodeBatch* create_batch() const;
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
@@ -365,6 +375,91 @@ public:
     unsigned int refractory_counts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Batch of neurons updated together, with parameters and state stored as
+   * arrays over the neurons. The neurons of a block are integrated in
+   * lockstep by BlockRKF45, which has the same step size control as the GSL
+   * solver used by update().
+   */
+  class Batch_ : public NodeBatch
+  {
+  public:
+    Batch_();
+
+  private:
+    //! Indices of the arrays over the neurons
+    enum
+    {
+      Y = 0, //!< first of the State_::STATE_VEC_SIZE arrays of the state vector
+      R = Y + State_::STATE_VEC_SIZE, //!< refractory counter, stored as double like all arrays
+      I_STIM,
+      INTEGRATION_STEP,
+      T, //!< time within the current step
+      V_EFF, //!< membrane potential entering the dynamics, computed by Dynamics_
+      I_SPIKE, //!< spike current, computed by Dynamics_
+      V_PEAK,
+      V_SPIKE, //!< threshold for spike detection, see Variables_::V_peak
+      V_RESET,
+      G_L,
+      C_M,
+      E_EX,
+      E_IN,
+      E_LEAK,
+      DELTA_T,
+      TAU_W,
+      A,
+      B,
+      V_TH,
+      TAU_SYN_EX,
+      TAU_SYN_IN,
+      I_E,
+      GSL_ERROR_TOL,
+      G0_EX,
+      G0_IN,
+      REFRACTORY_COUNTS,
+      NUM_ARRAYS
+    };
+
+    //! Indices of the input channels
+    enum
+    {
+      SPIKE_EXC = 0,
+      SPIKE_INH,
+      CURRENTS,
+      NUM_INPUT_CHANNELS
+    };
+
+    //! Right-hand side of the dynamics of the neurons of a block, see aeif_cond_alpha_dynamics()
+    struct Dynamics_
+    {
+      Dynamics_( Batch_&, const size_t begin );
+
+      void operator()( const double* const y[], double* const f[], const size_t n ) const;
+
+      Batch_& batch_;
+      const size_t begin_;
+    };
+
+    aeif_cond_alpha&
+    node_( const size_t i ) const
+    {
+      return *static_cast< aeif_cond_alpha* >( nodes_[ i ] );
+    }
+
+    void load_( const size_t );
+    void store_( const size_t );
+    void read_input_( const size_t, const size_t, const long, const long );
+    void step_( const size_t, const size_t, const long );
+    void record_( const size_t, const long );
+
+    BlockRKF45< State_::STATE_VEC_SIZE > integrator_;
+
+    //! Non-zero for the neurons of the current block that take an integration step
+    std::vector< unsigned char > integrating_;
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out state vector elements, used by UniversalDataLogger
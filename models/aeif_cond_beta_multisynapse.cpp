@@ -93,8 +93,9 @@ aeif_cond_beta_multisynapse::get_data_access_functor( size_t elem )
  * Right-hand side function
  * ---------------------------------------------------------------- */
 
-extern "C" int
-aeif_cond_beta_multisynapse_dynamics( double, const double y[], double f[], void* pnode )
+template < size_t N >
+int
+aeif_cond_beta_multisynapse::dynamics_( double, const double y[], double f[], void* pnode )
 {
   // y[] is the state vector supplied by the integrator,
   // not the state vector in the node, node.S_.y[].
@@ -105,6 +106,9 @@ aeif_cond_beta_multisynapse_dynamics( double, const double y[], double f[], void
   assert( pnode );
   const nest::aeif_cond_beta_multisynapse& node = *( reinterpret_cast< nest::aeif_cond_beta_multisynapse* >( pnode ) );
 
+  assert( N == 0 or N == node.P_.n_receptors() );
+  const size_t n_receptors = N > 0 ? N : node.P_.n_receptors();
+
   const bool is_refractory = node.S_.r_ > 0;
 
   // Clamp membrane potential to V_reset while refractory, otherwise bound
@@ -115,7 +119,7 @@ aeif_cond_beta_multisynapse_dynamics( double, const double y[], double f[], void
 
   // I_syn = - sum_k g_k (V - E_rev_k).
   double I_syn = 0.0;
-  for ( size_t i = 0; i < node.P_.n_receptors(); ++i )
+  for ( size_t i = 0; i < n_receptors; ++i )
   {
     const size_t j = i * S::NUM_STATE_ELEMENTS_PER_RECEPTOR;
     I_syn += y[ S::G + j ] * ( node.P_.E_rev[ i ] - V );
@@ -132,7 +136,7 @@ aeif_cond_beta_multisynapse_dynamics( double, const double y[], double f[], void
   // Adaptation current w.
   f[ S::W ] = ( node.P_.a * ( V - node.P_.E_L ) - w ) / node.P_.tau_w;
 
-  for ( size_t i = 0; i < node.P_.n_receptors(); ++i )
+  for ( size_t i = 0; i < n_receptors; ++i )
   {
     const size_t j = i * S::NUM_STATE_ELEMENTS_PER_RECEPTOR;
     // Synaptic conductance derivative dG/dt
@@ -143,6 +147,12 @@ aeif_cond_beta_multisynapse_dynamics( double, const double y[], double f[], void
   return GSL_SUCCESS;
 }
 
+extern "C" int
+aeif_cond_beta_multisynapse_dynamics( double t, const double y[], double f[], void* pnode )
+{
+  return aeif_cond_beta_multisynapse::dynamics_< 0 >( t, y, f, pnode );
+}
+
 /* ----------------------------------------------------------------
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
@@ -472,21 +482,44 @@ aeif_cond_beta_multisynapse::calibrate()
   S_.y_.resize(
     State_::NUMBER_OF_FIXED_STATES_ELEMENTS + ( State_::NUM_STATE_ELEMENTS_PER_RECEPTOR * P_.n_receptors() ), 0.0 );
 
-  // reallocate instance of stepping function for ODE GSL solver
-  if ( B_.s_ != 0 )
+  // reallocate stepping and evolution function for ODE GSL solver only if
+  // the number of receptors has changed, otherwise reset them
+  if ( B_.s_ != 0 and B_.sys_.dimension == S_.y_.size() )
   {
-    gsl_odeiv_step_free( B_.s_ );
+    gsl_odeiv_step_reset( B_.s_ );
+    gsl_odeiv_evolve_reset( B_.e_ );
   }
-  B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, S_.y_.size() );
-
-  // reallocate instance of evolution function for ODE GSL solver
-  if ( B_.e_ != 0 )
+  else
   {
-    gsl_odeiv_evolve_free( B_.e_ );
+    if ( B_.s_ != 0 )
+    {
+      gsl_odeiv_step_free( B_.s_ );
+      gsl_odeiv_evolve_free( B_.e_ );
+    }
+    B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, S_.y_.size() );
+    B_.e_ = gsl_odeiv_evolve_alloc( S_.y_.size() );
   }
-  B_.e_ = gsl_odeiv_evolve_alloc( S_.y_.size() );
 
   B_.sys_.dimension = S_.y_.size();
+
+  // loops over few receptors are unrolled in the right-hand side
+  switch ( P_.n_receptors() )
+  {
+  case 1:
+    B_.sys_.function = dynamics_< 1 >;
+    break;
+  case 2:
+    B_.sys_.function = dynamics_< 2 >;
+    break;
+  case 3:
+    B_.sys_.function = dynamics_< 3 >;
+    break;
+  case 4:
+    B_.sys_.function = dynamics_< 4 >;
+    break;
+  default:
+    B_.sys_.function = aeif_cond_beta_multisynapse_dynamics;
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -212,6 +212,15 @@ private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  /**
+   * Right-hand side for N receptors, or any number of receptors if N is 0.
+   * Instances with N > 0 have loops over receptors of fixed length, which
+   * the compiler unrolls, and are passed to GSL by calibrate() for up to
+   * four receptors.
+   */
+  template < size_t N >
+  static int dynamics_( double, const double*, double*, void* );
+
   // The next three classes need to be friends to access the State_ class/member
   friend class DynamicRecordablesMap< aeif_cond_beta_multisynapse >;
   friend class DynamicUniversalDataLogger< aeif_cond_beta_multisynapse >;
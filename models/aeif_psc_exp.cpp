@@ -25,6 +25,7 @@
 #ifdef HAVE_GSL
 
 // C++ includes:
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <iomanip>
@@ -512,6 +513,261 @@ nest::aeif_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+bool
+nest::aeif_psc_exp::supports_batch_update() const
+{
+  return true;
+}
+
+nest::NodeBatch*
+nest::aeif_psc_exp::create_batch() const
+{
+  return new Batch_();
+}
+
+nest::aeif_psc_exp::Batch_::Batch_()
+  : NodeBatch( NUM_ARRAYS, NUM_INPUT_CHANNELS )
+  , integrator_( block_size_ )
+  , integrating_( block_size_ )
+{
+}
+
+nest::aeif_psc_exp::Batch_::Dynamics_::Dynamics_( Batch_& batch, const size_t begin )
+  : batch_( batch )
+  , begin_( begin )
+{
+}
+
+void
+nest::aeif_psc_exp::Batch_::Dynamics_::operator()( const double* const y[], double* const f[], const size_t n ) const
+{
+  typedef State_ S;
+
+  const double* const r = batch_.array_( R ) + begin_;
+  const double* const I_stim = batch_.array_( I_STIM ) + begin_;
+  const double* const V_peak = batch_.array_( V_PEAK ) + begin_;
+  const double* const V_reset = batch_.array_( V_RESET ) + begin_;
+  const double* const g_L = batch_.array_( G_L ) + begin_;
+  const double* const C_m = batch_.array_( C_M ) + begin_;
+  const double* const E_L = batch_.array_( E_LEAK ) + begin_;
+  const double* const Delta_T = batch_.array_( DELTA_T ) + begin_;
+  const double* const tau_w = batch_.array_( TAU_W ) + begin_;
+  const double* const a = batch_.array_( A ) + begin_;
+  const double* const V_th = batch_.array_( V_TH ) + begin_;
+  const double* const tau_syn_ex = batch_.array_( TAU_SYN_EX ) + begin_;
+  const double* const tau_syn_in = batch_.array_( TAU_SYN_IN ) + begin_;
+  const double* const I_e = batch_.array_( I_E ) + begin_;
+
+  const double* const V_m = y[ S::V_M ];
+  const double* const I_syn_ex = y[ S::I_EXC ];
+  const double* const I_syn_in = y[ S::I_INH ];
+  const double* const w = y[ S::W ];
+
+  double* const dV_m = f[ S::V_M ];
+  double* const dI_syn_ex = f[ S::I_EXC ];
+  double* const dI_syn_in = f[ S::I_INH ];
+  double* const dw = f[ S::W ];
+
+  double* const V = batch_.array_( V_EFF ) + begin_;
+  double* const I_spike = batch_.array_( I_SPIKE ) + begin_;
+
+  // Same arithmetic as aeif_psc_exp_dynamics(), in three passes. The
+  // selections and the exponential do not vectorize and are done first, so
+  // that the bulk of the arithmetic can be vectorized.
+  for ( size_t j = 0; j < n; ++j )
+  {
+    V[ j ] = r[ j ] > 0 ? V_reset[ j ] : std::min( V_m[ j ], V_peak[ j ] );
+    I_spike[ j ] =
+      Delta_T[ j ] == 0. ? 0. : ( g_L[ j ] * Delta_T[ j ] * std::exp( ( V[ j ] - V_th[ j ] ) / Delta_T[ j ] ) );
+  }
+
+#pragma omp simd
+  for ( size_t j = 0; j < n; ++j )
+  {
+    // dv/dt
+    dV_m[ j ] = ( -g_L[ j ] * ( V[ j ] - E_L[ j ] ) + I_spike[ j ] + I_syn_ex[ j ] - I_syn_in[ j ] - w[ j ] + I_e[ j ]
+                  + I_stim[ j ] )
+      / C_m[ j ];
+
+    dI_syn_ex[ j ] = -I_syn_ex[ j ] / tau_syn_ex[ j ]; // Exc. synaptic current (pA)
+
+    dI_syn_in[ j ] = -I_syn_in[ j ] / tau_syn_in[ j ]; // Inh. synaptic current (pA)
+
+    // Adaptation current w.
+    dw[ j ] = ( a[ j ] * ( V[ j ] - E_L[ j ] ) - w[ j ] ) / tau_w[ j ];
+  }
+
+  // the membrane potential is clamped while refractory
+  for ( size_t j = 0; j < n; ++j )
+  {
+    if ( r[ j ] > 0 )
+    {
+      dV_m[ j ] = 0.;
+    }
+  }
+}
+
+void
+nest::aeif_psc_exp::Batch_::load_( const size_t i )
+{
+  const aeif_psc_exp& node = node_( i );
+
+  for ( size_t k = 0; k < State_::STATE_VEC_SIZE; ++k )
+  {
+    array_( Y + k )[ i ] = node.S_.y_[ k ];
+  }
+  array_( R )[ i ] = node.S_.r_;
+  array_( I_STIM )[ i ] = node.B_.I_stim_;
+  array_( INTEGRATION_STEP )[ i ] = node.B_.IntegrationStep_;
+
+  array_( V_PEAK )[ i ] = node.P_.V_peak_;
+  array_( V_SPIKE )[ i ] = node.V_.V_peak;
+  array_( V_RESET )[ i ] = node.P_.V_reset_;
+  array_( G_L )[ i ] = node.P_.g_L;
+  array_( C_M )[ i ] = node.P_.C_m;
+  array_( E_LEAK )[ i ] = node.P_.E_L;
+  array_( DELTA_T )[ i ] = node.P_.Delta_T;
+  array_( TAU_W )[ i ] = node.P_.tau_w;
+  array_( A )[ i ] = node.P_.a;
+  array_( B )[ i ] = node.P_.b;
+  array_( V_TH )[ i ] = node.P_.V_th;
+  array_( TAU_SYN_EX )[ i ] = node.P_.tau_syn_ex;
+  array_( TAU_SYN_IN )[ i ] = node.P_.tau_syn_in;
+  array_( I_E )[ i ] = node.P_.I_e;
+  array_( GSL_ERROR_TOL )[ i ] = node.P_.gsl_error_tol;
+  array_( REFRACTORY_COUNTS )[ i ] = node.V_.refractory_counts_;
+
+  if ( node.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( i );
+  }
+}
+
+void
+nest::aeif_psc_exp::Batch_::store_( const size_t i )
+{
+  aeif_psc_exp& node = node_( i );
+
+  for ( size_t k = 0; k < State_::STATE_VEC_SIZE; ++k )
+  {
+    node.S_.y_[ k ] = array_( Y + k )[ i ];
+  }
+  node.S_.r_ = static_cast< unsigned int >( array_( R )[ i ] );
+  node.B_.I_stim_ = array_( I_STIM )[ i ];
+  node.B_.IntegrationStep_ = array_( INTEGRATION_STEP )[ i ];
+}
+
+void
+nest::aeif_psc_exp::Batch_::read_input_( const size_t begin, const size_t end, const long from, const long to )
+{
+  for ( size_t i = begin; i < end; ++i )
+  {
+    Buffers_& buffers = node_( i ).B_;
+    for ( long lag = from; lag < to; ++lag )
+    {
+      input_( SPIKE_EXC, lag )[ i - begin ] = buffers.spike_exc_.get_value( lag );
+      input_( SPIKE_INH, lag )[ i - begin ] = buffers.spike_inh_.get_value( lag );
+      input_( CURRENTS, lag )[ i - begin ] = buffers.currents_.get_value( lag );
+    }
+  }
+}
+
+void
+nest::aeif_psc_exp::Batch_::step_( const size_t begin, const size_t end, const long lag )
+{
+  typedef State_ S;
+
+  double* y[ S::STATE_VEC_SIZE ];
+  for ( size_t k = 0; k < S::STATE_VEC_SIZE; ++k )
+  {
+    y[ k ] = array_( Y + k ) + begin;
+  }
+  double* const r = array_( R ) + begin;
+  double* const I_stim = array_( I_STIM ) + begin;
+  double* const h = array_( INTEGRATION_STEP ) + begin;
+  double* const t = array_( T ) + begin;
+  const double* const tol = array_( GSL_ERROR_TOL ) + begin;
+  const double* const V_spike = array_( V_SPIKE ) + begin;
+  const double* const V_reset = array_( V_RESET ) + begin;
+  const double* const b = array_( B ) + begin;
+  const double* const refractory_counts = array_( REFRACTORY_COUNTS ) + begin;
+
+  const double step = Time::get_resolution().get_ms();
+  const size_t n = end - begin;
+  std::fill( t, t + n, 0.0 );
+  std::fill( spike_mask_.begin(), spike_mask_.begin() + n, 0 );
+
+  // integrate all neurons over the step as in update(), handling spikes
+  // after each integration step
+  const Dynamics_ dynamics( *this, begin );
+  size_t num_integrating = n;
+  while ( num_integrating > 0 )
+  {
+    for ( size_t j = 0; j < n; ++j )
+    {
+      integrating_[ j ] = t[ j ] < step;
+    }
+
+    integrator_.apply( dynamics, n, step, t, h, tol, y );
+
+    num_integrating = 0;
+    for ( size_t j = 0; j < n; ++j )
+    {
+      if ( not integrating_[ j ] )
+      {
+        continue;
+      }
+
+      // check for unreasonable values; we allow V_M to explode
+      if ( y[ S::V_M ][ j ] < -1e3 || y[ S::W ][ j ] < -1e6 || y[ S::W ][ j ] > 1e6 )
+      {
+        throw NumericalInstability( node_( begin + j ).get_name() );
+      }
+
+      if ( r[ j ] > 0 )
+      {
+        y[ S::V_M ][ j ] = V_reset[ j ];
+      }
+      else if ( y[ S::V_M ][ j ] >= V_spike[ j ] )
+      {
+        y[ S::V_M ][ j ] = V_reset[ j ];
+        y[ S::W ][ j ] += b[ j ]; // spike-driven adaptation
+        r[ j ] = refractory_counts[ j ] > 0 ? refractory_counts[ j ] + 1 : 0;
+        ++spike_mask_[ j ];
+      }
+
+      num_integrating += t[ j ] < step;
+    }
+  }
+
+  double* const I_syn_ex = y[ S::I_EXC ];
+  double* const I_syn_in = y[ S::I_INH ];
+  const double* const spike_exc = input_( SPIKE_EXC, lag );
+  const double* const spike_inh = input_( SPIKE_INH, lag );
+  const double* const currents = input_( CURRENTS, lag );
+  for ( size_t j = 0; j < n; ++j )
+  {
+    // decrement refractory count
+    if ( r[ j ] > 0 )
+    {
+      r[ j ] -= 1;
+    }
+
+    // apply spikes
+    I_syn_ex[ j ] += spike_exc[ j ];
+    I_syn_in[ j ] += spike_inh[ j ];
+
+    // set new input current
+    I_stim[ j ] = currents[ j ];
+  }
+}
+
+void
+nest::aeif_psc_exp::Batch_::record_( const size_t i, const long step )
+{
+  node_( i ).B_.logger_.record_data( step );
+}
+
 void
 nest::aeif_psc_exp::handle( SpikeEvent& e )
 {
@@ -26,6 +26,9 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection.h"
@@ -222,14 +225,15 @@ inline void
 clopath_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSynapseProperties& )
 {
   double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
   // use accessor functions (inherited from Connection< >) to obtain delay and
   // target
   Node* target = get_target( t );
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry_extended >::iterator start;
-  std::deque< histentry_extended >::iterator finish;
+  HistoryBuffer< histentry_extended >::iterator start;
+  HistoryBuffer< histentry_extended >::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
@@ -244,7 +248,7 @@ clopath_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSyna
   while ( start != finish )
   {
     const double minus_dt = t_lastspike_ - ( start->t_ + dendritic_delay );
-    weight_ = facilitate_( weight_, start->dw_, x_bar_ * exp( minus_dt / tau_x_ ) );
+    weight_ = facilitate_( weight_, start->dw_, x_bar_ * numerics::select_exp( minus_dt / tau_x_, fast_exp ) );
     ++start;
   }
 
@@ -260,7 +264,7 @@ clopath_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSyna
   e();
 
   // compute the trace of the presynaptic spike train
-  x_bar_ = x_bar_ * std::exp( ( t_lastspike_ - t_spike ) / tau_x_ ) + 1.0 / tau_x_;
+  x_bar_ = x_bar_ * numerics::select_exp( ( t_lastspike_ - t_spike ) / tau_x_, fast_exp ) + 1.0 / tau_x_;
 
   t_lastspike_ = t_spike;
 }
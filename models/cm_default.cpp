@@ -21,6 +21,9 @@
  */
 #include "cm_default.h"
 
+// C++ includes:
+#include <algorithm>
+
 
 namespace nest
 {
@@ -313,6 +316,103 @@ nest::cm_default::update( Time const& origin, const long from, const long to )
   }
 }
 
+bool
+nest::cm_default::supports_batch_update() const
+{
+  return true;
+}
+
+nest::NodeBatch*
+nest::cm_default::create_batch() const
+{
+  return new Batch_();
+}
+
+nest::cm_default::Batch_::Batch_()
+  : NodeBatch( 0, 0 )
+{
+}
+
+void
+nest::cm_default::Batch_::load_( const size_t i )
+{
+  // the state stays in the neurons, the batch only groups them by tree structure
+  const size_t block = i / block_size_;
+  if ( groups_.size() <= block )
+  {
+    groups_.resize( block + 1 );
+  }
+
+  const std::vector< long >& parents = node_( i ).c_tree_.get_hines_parents();
+  std::vector< Group_ >& groups = groups_[ block ];
+  auto group = std::find_if( groups.begin(),
+    groups.end(),
+    [ this, &parents ]( const Group_& g ) { return node_( g.nodes[ 0 ] ).c_tree_.get_hines_parents() == parents; } );
+  if ( group == groups.end() )
+  {
+    groups.push_back( Group_() );
+    group = groups.end() - 1;
+  }
+  group->nodes.push_back( i );
+
+  if ( node_( i ).logger_.has_loggers() )
+  {
+    logged_.push_back( i );
+  }
+}
+
+void
+nest::cm_default::Batch_::store_( const size_t )
+{
+}
+
+void
+nest::cm_default::Batch_::read_input_( const size_t, const size_t, const long, const long )
+{
+  // the compartments read their input when the matrix is constructed
+}
+
+void
+nest::cm_default::Batch_::step_( const size_t begin, const size_t end, const long lag )
+{
+  for ( Group_& group : groups_[ begin / block_size_ ] )
+  {
+    const size_t n_lanes = group.nodes.size();
+    if ( group.matrix.num_lanes() != n_lanes )
+    {
+      group.matrix = HinesMatrix( node_( group.nodes[ 0 ] ).c_tree_.get_hines_parents(), n_lanes );
+    }
+
+    for ( size_t lane = 0; lane < n_lanes; ++lane )
+    {
+      const size_t i = group.nodes[ lane ];
+      CompTree& c_tree = node_( i ).c_tree_;
+
+      // store the previous soma voltage for the threshold crossing below
+      spike_mask_[ i - begin ] = c_tree.get_root()->v_comp < node_( i ).V_th_;
+
+      c_tree.construct_matrix( lag );
+      c_tree.load_matrix( group.matrix, lane );
+    }
+
+    group.matrix.solve();
+
+    for ( size_t lane = 0; lane < n_lanes; ++lane )
+    {
+      const size_t i = group.nodes[ lane ];
+      CompTree& c_tree = node_( i ).c_tree_;
+      c_tree.store_voltages( group.matrix, lane );
+      spike_mask_[ i - begin ] = spike_mask_[ i - begin ] and c_tree.get_root()->v_comp >= node_( i ).V_th_;
+    }
+  }
+}
+
+void
+nest::cm_default::Batch_::record_( const size_t i, const long step )
+{
+  node_( i ).logger_.record_data( step );
+}
+
 void
 nest::cm_default::handle( SpikeEvent& e )
 {
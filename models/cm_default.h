@@ -27,6 +27,7 @@
 #include "archiving_node.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch.h"
 #include "universal_data_logger.h"
 
 #include "cm_compartmentcurrents.h"
@@ -123,6 +124,14 @@ type is the compartment index, i.e.
     dc = nest.Create('dc_generator', {...})
     nest.Connect(dc, cm, syn_spec={..., 'receptor_type': 0}
 
+The voltages of the compartments are obtained by solving a linear system with
+one equation per compartment. At calibration, the compartments are numbered
+in Hines order, in which every compartment comes after its parent, so that the
+system is solved by one loop towards the soma and one loop away from it. If
+the kernel property ``vectorized_update`` is set, the systems of neurons with
+the same tree structure are solved together in blocks, with the same results
+as for individual neurons.
+
 Parameters
 ++++++++++
 
@@ -246,6 +255,43 @@ private:
 
   void update( Time const&, const long, const long );
 
+  bool supports_batch_update() const;
+  NodeBatch* create_batch() const;
+
+  /**
+   * Batch of neurons updated together. The neurons of a block are grouped by
+   * the structure of their tree, and the matrix equations of each group are
+   * solved in one HinesMatrix with one lane per neuron.
+   */
+  class Batch_ : public NodeBatch
+  {
+  public:
+    Batch_();
+
+  private:
+    //! Neurons of a block with the same tree structure
+    struct Group_
+    {
+      std::vector< size_t > nodes;
+      HinesMatrix matrix;
+    };
+
+    cm_default&
+    node_( const size_t i ) const
+    {
+      return *static_cast< cm_default* >( nodes_[ i ] );
+    }
+
+    void load_( const size_t );
+    void store_( const size_t );
+    void read_input_( const size_t, const size_t, const long, const long );
+    void step_( const size_t, const size_t, const long );
+    void record_( const size_t, const long );
+
+    //! Groups of the neurons of each block
+    std::vector< std::vector< Group_ > > groups_;
+  };
+
   CompTree c_tree_;
   std::vector< RingBuffer > syn_buffers_;
 
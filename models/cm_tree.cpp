@@ -21,11 +21,13 @@
  */
 #include "cm_tree.h"
 
+// C++ includes:
+#include <cassert>
+#include <map>
+
 
 nest::Compartment::Compartment( const long compartment_index, const long parent_index )
-  : xx_( 0.0 )
-  , yy_( 0.0 )
-  , comp_index( compartment_index )
+  : comp_index( compartment_index )
   , p_index( parent_index )
   , parent( nullptr )
   , v_comp( 0.0 )
@@ -41,7 +43,6 @@ nest::Compartment::Compartment( const long compartment_index, const long parent_
   , ff( 0.0 )
   , gg( 0.0 )
   , hh( 0.0 )
-  , n_passed( 0 )
 {
   v_comp = el;
 
@@ -50,9 +51,7 @@ nest::Compartment::Compartment( const long compartment_index, const long parent_
 nest::Compartment::Compartment( const long compartment_index,
   const long parent_index,
   const DictionaryDatum& compartment_params )
-  : xx_( 0.0 )
-  , yy_( 0.0 )
-  , comp_index( compartment_index )
+  : comp_index( compartment_index )
   , p_index( parent_index )
   , parent( nullptr )
   , v_comp( 0.0 )
@@ -68,7 +67,6 @@ nest::Compartment::Compartment( const long compartment_index,
   , ff( 0.0 )
   , gg( 0.0 )
   , hh( 0.0 )
-  , n_passed( 0 )
 {
 
   updateValue< double >( compartment_params, names::C_m, ca );
@@ -150,12 +148,97 @@ nest::Compartment::construct_matrix_element( const long lag )
 }
 
 
+nest::HinesMatrix::HinesMatrix()
+  : parents_()
+  , num_lanes_( 0 )
+{
+}
+
+nest::HinesMatrix::HinesMatrix( const std::vector< long >& parents, const size_t num_lanes )
+  : parents_( parents )
+  , num_lanes_( num_lanes )
+  , gg_( parents.size() * num_lanes, 0.0 )
+  , ff_( parents.size() * num_lanes, 0.0 )
+  , hh_( parents.size() * num_lanes, 0.0 )
+  , xx_( parents.size() * num_lanes, 0.0 )
+  , yy_( parents.size() * num_lanes, 0.0 )
+  , v_( parents.size() * num_lanes, 0.0 )
+{
+}
+
+/**
+ * Solve the matrix equations with O(n) algorithm
+ */
+void
+nest::HinesMatrix::solve()
+{
+  const size_t n_lanes = num_lanes_;
+
+  // down sweep from the last compartment to the root, which puts to zero the
+  // sub diagonal matrix elements
+  for ( long i = static_cast< long >( parents_.size() ) - 1; i >= 0; --i )
+  {
+    double* const gg = &gg_[ i * n_lanes ];
+    double* const ff = &ff_[ i * n_lanes ];
+    const double* const hh = &hh_[ i * n_lanes ];
+    double* const xx = &xx_[ i * n_lanes ];
+    double* const yy = &yy_[ i * n_lanes ];
+
+    // include inputs from child compartments
+    for ( size_t l = 0; l < n_lanes; ++l )
+    {
+      gg[ l ] -= xx[ l ];
+      ff[ l ] -= yy[ l ];
+      xx[ l ] = 0.0;
+      yy[ l ] = 0.0;
+    }
+
+    const long p = parents_[ i ];
+    if ( p >= 0 )
+    {
+      double* const xx_parent = &xx_[ p * n_lanes ];
+      double* const yy_parent = &yy_[ p * n_lanes ];
+      for ( size_t l = 0; l < n_lanes; ++l )
+      {
+        xx_parent[ l ] += hh[ l ] * hh[ l ] / gg[ l ];
+        yy_parent[ l ] += ff[ l ] * hh[ l ] / gg[ l ];
+      }
+    }
+  }
+
+  // up sweep from the root to set the voltages
+  for ( size_t i = 0; i < parents_.size(); ++i )
+  {
+    const double* const gg = &gg_[ i * n_lanes ];
+    const double* const ff = &ff_[ i * n_lanes ];
+    const double* const hh = &hh_[ i * n_lanes ];
+    double* const v = &v_[ i * n_lanes ];
+
+    const long p = parents_[ i ];
+    if ( p >= 0 )
+    {
+      const double* const v_parent = &v_[ p * n_lanes ];
+      for ( size_t l = 0; l < n_lanes; ++l )
+      {
+        v[ l ] = ( ff[ l ] - v_parent[ l ] * hh[ l ] ) / gg[ l ];
+      }
+    }
+    else
+    {
+      for ( size_t l = 0; l < n_lanes; ++l )
+      {
+        v[ l ] = ( ff[ l ] - 0.0 * hh[ l ] ) / gg[ l ];
+      }
+    }
+  }
+}
+
+
 nest::CompTree::CompTree()
   : root_( -1, -1 )
   , size_( 0 )
 {
   compartments_.resize( 0 );
-  leafs_.resize( 0 );
 }
 
 /**
@@ -277,7 +360,6 @@ nest::CompTree::init_pointers()
 {
   set_parents();
   set_compartments();
-  set_leafs();
 }
 
 /**
@@ -313,19 +395,48 @@ nest::CompTree::set_compartments()
 }
 
 /**
- * Creates a vector of compartment pointers of compartments that are also leafs of the tree.
+ * Numbers the compartments in Hines order, in which each compartment comes
+ * after its parent. Going through this order backwards visits the leafs in
+ * the order in which they were added, each followed by those of its
+ * ancestors whose children have all been visited. The contributions of the
+ * children to a compartment are thus summed in a fixed order.
  */
 void
-nest::CompTree::set_leafs()
+nest::CompTree::set_hines_order()
 {
-  leafs_.clear();
+  std::vector< Compartment* > downsweep_order;
+  std::map< Compartment*, size_t > n_passed;
   for ( auto compartment_it = compartments_.begin(); compartment_it != compartments_.end(); ++compartment_it )
   {
-    if ( int( ( *compartment_it )->children.size() ) == 0 )
+    if ( not( *compartment_it )->children.empty() )
     {
-      leafs_.push_back( *compartment_it );
+      continue;
     }
+
+    // go from the leaf towards the root as long as all children are done
+    Compartment* compartment = *compartment_it;
+    downsweep_order.push_back( compartment );
+    while ( compartment->parent != nullptr
+      and ++n_passed[ compartment->parent ] == compartment->parent->children.size() )
+    {
+      compartment = compartment->parent;
+      downsweep_order.push_back( compartment );
+    }
+  }
+  assert( downsweep_order.size() == compartments_.size() );
+
+  hines_compartments_.assign( downsweep_order.rbegin(), downsweep_order.rend() );
+
+  std::map< Compartment*, long > hines_index;
+  hines_parents_.clear();
+  for ( size_t i = 0; i < hines_compartments_.size(); ++i )
+  {
+    Compartment* parent = hines_compartments_[ i ]->parent;
+    hines_index[ hines_compartments_[ i ] ] = i;
+    hines_parents_.push_back( parent != nullptr ? hines_index[ parent ] : -1 );
   }
+
+  matrix_ = HinesMatrix( hines_parents_, 1 );
 }
 
 /**
@@ -377,6 +488,8 @@ nest::CompTree::calibrate()
   {
     ( *compartment_it )->calibrate();
   }
+
+  set_hines_order();
 }
 
 /**
@@ -415,61 +528,32 @@ nest::CompTree::construct_matrix( const long lag )
 }
 
 /**
- * Solve matrix with O(n) algorithm
+ * Solve matrix with O(n) algorithm, see HinesMatrix
  */
 void
 nest::CompTree::solve_matrix()
 {
-  std::vector< Compartment* >::iterator leaf_it = leafs_.begin();
-
-  // start the down sweep (puts to zero the sub diagonal matrix elements)
-  solve_matrix_downsweep( leafs_[ 0 ], leaf_it );
-
-  // do up sweep to set voltages
-  solve_matrix_upsweep( &root_, 0.0 );
+  load_matrix( matrix_, 0 );
+  matrix_.solve();
+  store_voltages( matrix_, 0 );
 }
 
 void
-nest::CompTree::solve_matrix_downsweep( Compartment* compartment, std::vector< Compartment* >::iterator leaf_it )
+nest::CompTree::load_matrix( HinesMatrix& matrix, const size_t lane ) const
 {
-  // compute the input output transformation at compartment
-  std::pair< double, double > output = compartment->io();
-
-  // move on to the parent layer
-  if ( compartment->parent != nullptr )
+  for ( size_t i = 0; i < hines_compartments_.size(); ++i )
   {
-    Compartment* parent = compartment->parent;
-    // gather input from child layers
-    parent->gather_input( output );
-    // move on to next compartments
-    ++parent->n_passed;
-    if ( parent->n_passed == int( parent->children.size() ) )
-    {
-      parent->n_passed = 0;
-      // move on to next compartment
-      solve_matrix_downsweep( parent, leaf_it );
-    }
-    else
-    {
-      // start at next leaf
-      ++leaf_it;
-      if ( leaf_it != leafs_.end() )
-      {
-        solve_matrix_downsweep( *leaf_it, leaf_it );
-      }
-    }
+    const Compartment* compartment = hines_compartments_[ i ];
+    matrix.set_row( i, lane, compartment->gg, compartment->ff, compartment->hh );
   }
 }
 
 void
-nest::CompTree::solve_matrix_upsweep( Compartment* compartment, double vv )
+nest::CompTree::store_voltages( const HinesMatrix& matrix, const size_t lane )
 {
-  // compute compartment voltage
-  vv = compartment->calc_v( vv );
-  // move on to child compartments
-  for ( auto child_it = compartment->children.begin(); child_it != compartment->children.end(); ++child_it )
+  for ( size_t i = 0; i < hines_compartments_.size(); ++i )
   {
-    solve_matrix_upsweep( &( *child_it ), vv );
+    hines_compartments_[ i ]->v_comp = matrix.get_voltage( i, lane );
   }
 }
 
@@ -50,11 +50,6 @@ namespace nest
 
 class Compartment
 {
-private:
-  // aggragators for numerical integration
-  double xx_;
-  double yy_;
-
 public:
   // compartment index
   long comp_index;
@@ -85,8 +80,6 @@ public:
   double ff;
   double gg;
   double hh;
-  // passage counter for recursion
-  int n_passed;
 
   // constructor, destructor
   Compartment( const long compartment_index, const long parent_index );
@@ -99,48 +92,61 @@ public:
 
   // matrix construction
   void construct_matrix_element( const long lag );
-
-  // maxtrix inversion
-  inline void gather_input( const std::pair< double, double >& in );
-  inline std::pair< double, double > io();
-  inline double calc_v( const double v_in );
 }; // Compartment
 
 
-/*
-Short helper functions for solving the matrix equation. Can hopefully be inlined
-*/
-inline void
-nest::Compartment::gather_input( const std::pair< double, double >& in )
-{
-  xx_ += in.first;
-  yy_ += in.second;
-}
-inline std::pair< double, double >
-nest::Compartment::io()
-{
-  // include inputs from child compartments
-  gg -= xx_;
-  ff -= yy_;
-
-  // output values
-  double g_val( hh * hh / gg );
-  double f_val( ff * hh / gg );
-
-  return std::make_pair( g_val, f_val );
-}
-inline double
-nest::Compartment::calc_v( const double v_in )
+/**
+ * Matrix equations of one or more trees with the same structure, solved
+ * together.
+ *
+ * The compartments are numbered in Hines order, in which every compartment
+ * comes after its parent, so the equations are solved by one loop towards
+ * the root and one loop away from it. Elements are stored with the trees
+ * (lanes) as the innermost dimension, so that the loops over the lanes can
+ * be vectorized. Each lane is solved with the same operations in the same
+ * order as a single tree.
+ */
+class HinesMatrix
 {
-  // reset recursion variables
-  xx_ = 0.0;
-  yy_ = 0.0;
+public:
+  HinesMatrix();
+  HinesMatrix( const std::vector< long >& parents, const size_t num_lanes );
 
-  // compute voltage
-  v_comp = ( ff - v_in * hh ) / gg;
+  size_t
+  num_lanes() const
+  {
+    return num_lanes_;
+  }
 
-  return v_comp;
-}
+  //! Set the diagonal element, right hand side and element coupling to the parent of compartment i in a lane
+  void
+  set_row( const size_t i, const size_t lane, const double gg, const double ff, const double hh )
+  {
+    gg_[ i * num_lanes_ + lane ] = gg;
+    ff_[ i * num_lanes_ + lane ] = ff;
+    hh_[ i * num_lanes_ + lane ] = hh;
+  }
+
+  //! Voltage of compartment i in a lane after solve()
+  double
+  get_voltage( const size_t i, const size_t lane ) const
+  {
+    return v_[ i * num_lanes_ + lane ];
+  }
+
+  void solve();
+
+private:
+  std::vector< long > parents_; //!< Index of the parent of each compartment, -1 for the root
+  size_t num_lanes_;
+
+  std::vector< double > gg_;
+  std::vector< double > ff_;
+  std::vector< double > hh_;
+  std::vector< double > xx_; //!< Contributions of the children to gg_
+  std::vector< double > yy_; //!< Contributions of the children to ff_
+  std::vector< double > v_;
+};
 
 
 class CompTree
@@ -152,18 +158,18 @@ private:
   mutable Compartment root_;
   std::vector< long > compartment_indices_;
   std::vector< Compartment* > compartments_;
-  std::vector< Compartment* > leafs_;
 
-  long size_ = 0;
+  // compartments in Hines order and the index of their parent in this order
+  std::vector< Compartment* > hines_compartments_;
+  std::vector< long > hines_parents_;
+  HinesMatrix matrix_;
 
-  // recursion functions for matrix inversion
-  void solve_matrix_downsweep( Compartment* compartment_ptr, std::vector< Compartment* >::iterator leaf_it );
-  void solve_matrix_upsweep( Compartment* compartment, double vv );
+  long size_ = 0;
 
   // functions for pointer initialization
   void set_parents();
   void set_compartments();
-  void set_leafs();
+  void set_hines_order();
 
 public:
   // constructor, destructor
@@ -205,6 +211,21 @@ public:
   // solve the matrix equation for next timestep voltage
   void solve_matrix();
 
+  /**
+   * Index of the parent of each compartment in Hines order, -1 for the
+   * root. Trees with equal parents can be solved in one HinesMatrix.
+   */
+  const std::vector< long >&
+  get_hines_parents() const
+  {
+    return hines_parents_;
+  }
+
+  // copy the matrix equation into a lane of a matrix of trees with the same structure
+  void load_matrix( HinesMatrix& matrix, const size_t lane ) const;
+  // set the compartment voltages from a lane of a solved matrix
+  void store_voltages( const HinesMatrix& matrix, const size_t lane );
+
   // print function
   void print_tree() const;
 }; // CompTree
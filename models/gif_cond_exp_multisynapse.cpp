@@ -69,8 +69,9 @@ RecordablesMap< gif_cond_exp_multisynapse >::create()
 }
 } // namespace
 
-extern "C" int
-nest::gif_cond_exp_multisynapse_dynamics( double, const double* y, double* f, void* pnode )
+template < size_t N >
+int
+nest::gif_cond_exp_multisynapse::dynamics_( double, const double* y, double* f, void* pnode )
 {
   // a shorthand
   typedef nest::gif_cond_exp_multisynapse::State_ S;
@@ -79,6 +80,9 @@ nest::gif_cond_exp_multisynapse_dynamics( double, const double* y, double* f, vo
   assert( pnode );
   const nest::gif_cond_exp_multisynapse& node = *( reinterpret_cast< nest::gif_cond_exp_multisynapse* >( pnode ) );
 
+  assert( N == 0 or N == node.P_.n_receptors() );
+  const size_t n_receptors = N > 0 ? N : node.P_.n_receptors();
+
   // The following code is verbose for the sake of clarity. We assume that a
   // good compiler will optimize the verbosity away ...
   const bool is_refractory = node.S_.r_ref_ > 0;
@@ -88,7 +92,7 @@ nest::gif_cond_exp_multisynapse_dynamics( double, const double* y, double* f, vo
 
   // I_syn = - sum_k g_k (V - E_rev_k).
   double I_syn = 0.0;
-  for ( size_t i = 0; i < node.P_.n_receptors(); ++i )
+  for ( size_t i = 0; i < n_receptors; ++i )
   {
     const size_t j = i * S::NUM_STATE_ELEMENTS_PER_RECEPTOR;
     I_syn += -y[ S::G + j ] * ( V - node.P_.E_rev_[ i ] );
@@ -98,7 +102,7 @@ nest::gif_cond_exp_multisynapse_dynamics( double, const double* y, double* f, vo
   f[ S::V_M ] = is_refractory ? 0.0 : ( I_L + node.S_.I_stim_ + node.P_.I_e_ + I_syn - stc ) / node.P_.c_m_;
 
   // outputs: dg/dt
-  for ( size_t i = 0; i < node.P_.n_receptors(); i++ )
+  for ( size_t i = 0; i < n_receptors; i++ )
   {
     const size_t j = i * S::NUM_STATE_ELEMENTS_PER_RECEPTOR;
     f[ S::G + j ] = -y[ S::G + j ] / node.P_.tau_syn_[ i ];
@@ -107,6 +111,12 @@ nest::gif_cond_exp_multisynapse_dynamics( double, const double* y, double* f, vo
   return GSL_SUCCESS;
 }
 
+extern "C" int
+nest::gif_cond_exp_multisynapse_dynamics( double t, const double* y, double* f, void* pnode )
+{
+  return nest::gif_cond_exp_multisynapse::dynamics_< 0 >( t, y, f, pnode );
+}
+
 
 /* ----------------------------------------------------------------
  * Default constructors defining default parameters and state
@@ -448,8 +458,36 @@ nest::gif_cond_exp_multisynapse::init_buffers_()
 void
 nest::gif_cond_exp_multisynapse::calibrate()
 {
+  // reallocate stepping and evolution function for ODE GSL solver if the
+  // number of receptors has changed since init_buffers_()
+  if ( B_.sys_.dimension != S_.y_.size() )
+  {
+    gsl_odeiv_step_free( B_.s_ );
+    gsl_odeiv_evolve_free( B_.e_ );
+    B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, S_.y_.size() );
+    B_.e_ = gsl_odeiv_evolve_alloc( S_.y_.size() );
+  }
   B_.sys_.dimension = S_.y_.size();
 
+  // loops over few receptors are unrolled in the right-hand side
+  switch ( P_.n_receptors() )
+  {
+  case 1:
+    B_.sys_.function = dynamics_< 1 >;
+    break;
+  case 2:
+    B_.sys_.function = dynamics_< 2 >;
+    break;
+  case 3:
+    B_.sys_.function = dynamics_< 3 >;
+    break;
+  case 4:
+    B_.sys_.function = dynamics_< 4 >;
+    break;
+  default:
+    B_.sys_.function = gif_cond_exp_multisynapse_dynamics;
+  }
+
   B_.logger_.init();
 
   const double h = Time::get_resolution().get_ms();
@@ -251,6 +251,15 @@ private:
   // make dynamics function quasi-member
   friend int gif_cond_exp_multisynapse_dynamics( double, const double*, double*, void* );
 
+  /**
+   * Right-hand side for N receptors, or any number of receptors if N is 0.
+   * Instances with N > 0 have loops over receptors of fixed length, which
+   * the compiler unrolls, and are passed to GSL by calibrate() for up to
+   * four receptors.
+   */
+  template < size_t N >
+  static int dynamics_( double, const double*, double*, void* );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< gif_cond_exp_multisynapse >;
   friend class UniversalDataLogger< gif_cond_exp_multisynapse >;
@@ -23,6 +23,7 @@
 #include "iaf_psc_alpha.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -200,11 +201,13 @@ iaf_psc_alpha::State_::set( const DictionaryDatum& d, const Parameters_& p, doub
 
 iaf_psc_alpha::Buffers_::Buffers_( iaf_psc_alpha& n )
   : logger_( n )
+  , last_input_step_( -1 )
 {
 }
 
 iaf_psc_alpha::Buffers_::Buffers_( const Buffers_&, iaf_psc_alpha& n )
   : logger_( n )
+  , last_input_step_( -1 )
 {
 }
 
@@ -220,6 +223,7 @@ iaf_psc_alpha::iaf_psc_alpha()
   , B_( *this )
 {
   recordablesMap_.create();
+  V_.dormant_step_ = -1;
 }
 
 iaf_psc_alpha::iaf_psc_alpha( const iaf_psc_alpha& n )
@@ -228,6 +232,7 @@ iaf_psc_alpha::iaf_psc_alpha( const iaf_psc_alpha& n )
   , S_( n.S_ )
   , B_( n.B_, *this )
 {
+  V_.dormant_step_ = -1;
 }
 
 /* ----------------------------------------------------------------
@@ -238,41 +243,38 @@ void
 iaf_psc_alpha::init_buffers_()
 {
   B_.input_buffer_.clear(); // includes resize
+  B_.last_input_step_ = -1;
 
   B_.logger_.reset();
 
   ArchivingNode::clear_history();
 }
 
-void
-iaf_psc_alpha::calibrate()
+iaf_psc_alpha::Propagators_::Propagators_( const Parameters_& p )
 {
-  // ensures initialization in case mm connected after Simulate
-  B_.logger_.init();
-
   const double h = Time::get_resolution().get_ms();
 
   // these P are independent
-  V_.P11_ex_ = V_.P22_ex_ = std::exp( -h / P_.tau_ex_ );
-  V_.P11_in_ = V_.P22_in_ = std::exp( -h / P_.tau_in_ );
+  P11_ex_ = P22_ex_ = std::exp( -h / p.tau_ex_ );
+  P11_in_ = P22_in_ = std::exp( -h / p.tau_in_ );
 
-  V_.P33_ = std::exp( -h / P_.Tau_ );
+  P33_ = std::exp( -h / p.Tau_ );
 
-  V_.expm1_tau_m_ = numerics::expm1( -h / P_.Tau_ );
+  expm1_tau_m_ = numerics::expm1( -h / p.Tau_ );
 
   // these depend on the above. Please do not change the order.
-  V_.P30_ = -P_.Tau_ / P_.C_ * numerics::expm1( -h / P_.Tau_ );
-  V_.P21_ex_ = h * V_.P11_ex_;
-  V_.P21_in_ = h * V_.P11_in_;
+  P30_ = -p.Tau_ / p.C_ * numerics::expm1( -h / p.Tau_ );
+  P21_ex_ = h * P11_ex_;
+  P21_in_ = h * P11_in_;
 
   // these are determined according to a numeric stability criterion
-  V_.P31_ex_ = propagator_31( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P32_ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P31_in_ = propagator_31( P_.tau_in_, P_.Tau_, P_.C_, h );
-  V_.P32_in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
+  P31_ex_ = propagator_31( p.tau_ex_, p.Tau_, p.C_, h );
+  P32_ex_ = propagator_32( p.tau_ex_, p.Tau_, p.C_, h );
+  P31_in_ = propagator_31( p.tau_in_, p.Tau_, p.C_, h );
+  P32_in_ = propagator_32( p.tau_in_, p.Tau_, p.C_, h );
 
-  V_.EPSCInitialValue_ = 1.0 * numerics::e / P_.tau_ex_;
-  V_.IPSCInitialValue_ = 1.0 * numerics::e / P_.tau_in_;
+  EPSCInitialValue_ = 1.0 * numerics::e / p.tau_ex_;
+  IPSCInitialValue_ = 1.0 * numerics::e / p.tau_in_;
 
   // TauR specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_alpha can only handle refractory
@@ -294,9 +296,22 @@ iaf_psc_alpha::calibrate()
   // results. However, a neuron model capable of operating with real valued
   // spike time may exhibit a different effective refractory time.
 
-  V_.RefractoryCounts_ = Time( Time::ms( P_.TauR_ ) ).get_steps();
+  RefractoryCounts_ = Time( Time::ms( p.TauR_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
-  assert( V_.RefractoryCounts_ >= 0 );
+  assert( RefractoryCounts_ >= 0 );
+}
+
+void
+iaf_psc_alpha::calibrate()
+{
+  // ensures initialization in case mm connected after Simulate
+  B_.logger_.init();
+
+  // neurons with identical parameters share their propagators
+  V_.propagators_ = kernel().node_manager.get_propagator_cache().get< Propagators_ >(
+    get_thread(), { P_.Tau_, P_.C_, P_.TauR_, P_.tau_ex_, P_.tau_in_ }, P_ );
+
+  V_.dormant_step_ = -1;
 }
 
 /* ----------------------------------------------------------------
@@ -309,13 +324,26 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( V_.dormant_step_ >= 0 )
+  {
+    const long slice_begin = origin.get_steps() + from;
+    if ( B_.last_input_step_ < slice_begin )
+    {
+      // still no input, so the neuron cannot reach threshold
+      return;
+    }
+    wake_up_( slice_begin );
+  }
+
+  const Propagators_& prop = *V_.propagators_;
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( S_.r_ == 0 )
     {
       // neuron not refractory
-      S_.y3_ = V_.P30_ * ( S_.y0_ + P_.I_e_ ) + V_.P31_ex_ * S_.dI_ex_ + V_.P32_ex_ * S_.I_ex_ + V_.P31_in_ * S_.dI_in_
-        + V_.P32_in_ * S_.I_in_ + V_.expm1_tau_m_ * S_.y3_ + S_.y3_;
+      S_.y3_ = prop.P30_ * ( S_.y0_ + P_.I_e_ ) + prop.P31_ex_ * S_.dI_ex_ + prop.P32_ex_ * S_.I_ex_ + prop.P31_in_ * S_.dI_in_
+        + prop.P32_in_ * S_.I_in_ + prop.expm1_tau_m_ * S_.y3_ + S_.y3_;
 
       // lower bound of membrane potential
       S_.y3_ = ( S_.y3_ < P_.LowerBound_ ? P_.LowerBound_ : S_.y3_ );
@@ -327,31 +355,31 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     }
 
     // alpha shape EPSCs
-    S_.I_ex_ = V_.P21_ex_ * S_.dI_ex_ + V_.P22_ex_ * S_.I_ex_;
-    S_.dI_ex_ *= V_.P11_ex_;
+    S_.I_ex_ = prop.P21_ex_ * S_.dI_ex_ + prop.P22_ex_ * S_.I_ex_;
+    S_.dI_ex_ *= prop.P11_ex_;
 
     // get read access to the correct input-buffer slot
     const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
-    auto& input = B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+    const double* input = B_.input_buffer_.get_values_all_channels( input_buffer_slot );
 
     // Apply spikes delivered in this step; spikes arriving at T+1 have
     // an immediate effect on the state of the neuron
     V_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
-    S_.dI_ex_ += V_.EPSCInitialValue_ * V_.weighted_spikes_ex_;
+    S_.dI_ex_ += prop.EPSCInitialValue_ * V_.weighted_spikes_ex_;
 
     // alpha shape EPSCs
-    S_.I_in_ = V_.P21_in_ * S_.dI_in_ + V_.P22_in_ * S_.I_in_;
-    S_.dI_in_ *= V_.P11_in_;
+    S_.I_in_ = prop.P21_in_ * S_.dI_in_ + prop.P22_in_ * S_.I_in_;
+    S_.dI_in_ *= prop.P11_in_;
 
     // Apply spikes delivered in this step; spikes arriving at T+1 have
     // an immediate effect on the state of the neuron
     V_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
-    S_.dI_in_ += V_.IPSCInitialValue_ * V_.weighted_spikes_in_;
+    S_.dI_in_ += prop.IPSCInitialValue_ * V_.weighted_spikes_in_;
 
     // threshold crossing
     if ( S_.y3_ >= P_.Theta_ )
     {
-      S_.r_ = V_.RefractoryCounts_;
+      S_.r_ = prop.RefractoryCounts_;
       S_.y3_ = P_.V_reset_;
       // A supra-threshold membrane potential should never be observable.
       // The reset at the time of threshold crossing enables accurate
@@ -372,6 +400,243 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     // log state data
     B_.logger_.record_data( origin.get_steps() + lag );
   }
+
+  if ( kernel().simulation_manager.lazy_update() and is_quiescent_( origin.get_steps() + to ) )
+  {
+    V_.dormant_step_ = origin.get_steps() + to;
+  }
+}
+
+bool
+iaf_psc_alpha::is_quiescent_( const long step ) const
+{
+  // the current input is only constant while the neuron receives it, so it
+  // must have ended
+  if ( S_.r_ > 0 or S_.y0_ != 0. or B_.last_input_step_ >= step or B_.logger_.has_loggers() )
+  {
+    return false;
+  }
+
+  // Without input, the membrane potential relaxes to V_inf and the synaptic
+  // currents I( t ) = ( I + t dI ) exp( -t / tau_syn ) decay. The positive
+  // and negative parts of a current change the membrane potential by less
+  // than their integral, which is bounded by tau_syn * I + tau_syn^2 * dI
+  // with the positive or negative parts of I and dI, divided by C.
+  const double V_inf = P_.Tau_ / P_.C_ * P_.I_e_;
+  const double rise = ( P_.tau_ex_ * ( std::max( S_.I_ex_, 0. ) + P_.tau_ex_ * std::max( S_.dI_ex_, 0. ) )
+                        + P_.tau_in_ * ( std::max( S_.I_in_, 0. ) + P_.tau_in_ * std::max( S_.dI_in_, 0. ) ) )
+    / P_.C_;
+  const double fall = ( P_.tau_ex_ * ( std::max( -S_.I_ex_, 0. ) + P_.tau_ex_ * std::max( -S_.dI_ex_, 0. ) )
+                        + P_.tau_in_ * ( std::max( -S_.I_in_, 0. ) + P_.tau_in_ * std::max( -S_.dI_in_, 0. ) ) )
+    / P_.C_;
+  return std::max( S_.y3_, V_inf ) + rise < P_.Theta_ and std::min( S_.y3_, V_inf ) - fall > P_.LowerBound_;
+}
+
+void
+iaf_psc_alpha::wake_up_( const long step )
+{
+  assert( step >= V_.dormant_step_ );
+
+  // exact solution of the dynamics without input over the skipped steps
+  const double t = Time::get_resolution().get_ms() * ( step - V_.dormant_step_ );
+  const double V_inf = P_.Tau_ / P_.C_ * P_.I_e_;
+  const double P11_ex = std::exp( -t / P_.tau_ex_ );
+  const double P11_in = std::exp( -t / P_.tau_in_ );
+
+  S_.y3_ = V_inf + ( S_.y3_ - V_inf ) * std::exp( -t / P_.Tau_ )
+    + propagator_31( P_.tau_ex_, P_.Tau_, P_.C_, t ) * S_.dI_ex_
+    + propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, t ) * S_.I_ex_
+    + propagator_31( P_.tau_in_, P_.Tau_, P_.C_, t ) * S_.dI_in_
+    + propagator_32( P_.tau_in_, P_.Tau_, P_.C_, t ) * S_.I_in_;
+  S_.I_ex_ = ( S_.I_ex_ + t * S_.dI_ex_ ) * P11_ex;
+  S_.dI_ex_ *= P11_ex;
+  S_.I_in_ = ( S_.I_in_ + t * S_.dI_in_ ) * P11_in;
+  S_.dI_in_ *= P11_in;
+
+  V_.dormant_step_ = -1;
+}
+
+void
+iaf_psc_alpha::post_run_cleanup()
+{
+  // bring the state up to date, so that it can be inspected
+  if ( V_.dormant_step_ >= 0 )
+  {
+    wake_up_( kernel().simulation_manager.get_time().get_steps() );
+  }
+}
+
+bool
+iaf_psc_alpha::supports_batch_update() const
+{
+  return true;
+}
+
+NodeBatch*
+iaf_psc_alpha::create_batch() const
+{
+  return new Batch_();
+}
+
+iaf_psc_alpha::Batch_::Batch_()
+  : NodeBatch( NUM_ARRAYS, Buffers_::NUM_INPUT_CHANNELS )
+{
+}
+
+void
+iaf_psc_alpha::Batch_::load_( const size_t i )
+{
+  const iaf_psc_alpha& node = node_( i );
+  const Propagators_& prop = *node.V_.propagators_;
+
+  array_( I_E )[ i ] = node.P_.I_e_;
+  array_( THETA )[ i ] = node.P_.Theta_;
+  array_( V_RESET )[ i ] = node.P_.V_reset_;
+  array_( LOWER_BOUND )[ i ] = node.P_.LowerBound_;
+  array_( REFRACTORY_COUNTS )[ i ] = prop.RefractoryCounts_;
+
+  array_( EPSC_INITIAL_VALUE )[ i ] = prop.EPSCInitialValue_;
+  array_( IPSC_INITIAL_VALUE )[ i ] = prop.IPSCInitialValue_;
+  array_( P11_EX )[ i ] = prop.P11_ex_;
+  array_( P21_EX )[ i ] = prop.P21_ex_;
+  array_( P22_EX )[ i ] = prop.P22_ex_;
+  array_( P31_EX )[ i ] = prop.P31_ex_;
+  array_( P32_EX )[ i ] = prop.P32_ex_;
+  array_( P11_IN )[ i ] = prop.P11_in_;
+  array_( P21_IN )[ i ] = prop.P21_in_;
+  array_( P22_IN )[ i ] = prop.P22_in_;
+  array_( P31_IN )[ i ] = prop.P31_in_;
+  array_( P32_IN )[ i ] = prop.P32_in_;
+  array_( P30 )[ i ] = prop.P30_;
+  array_( EXPM1_TAU_M )[ i ] = prop.expm1_tau_m_;
+
+  array_( Y0 )[ i ] = node.S_.y0_;
+  array_( DI_EX )[ i ] = node.S_.dI_ex_;
+  array_( I_EX )[ i ] = node.S_.I_ex_;
+  array_( DI_IN )[ i ] = node.S_.dI_in_;
+  array_( I_IN )[ i ] = node.S_.I_in_;
+  array_( Y3 )[ i ] = node.S_.y3_;
+  array_( R )[ i ] = node.S_.r_;
+
+  if ( node.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( i );
+  }
+}
+
+void
+iaf_psc_alpha::Batch_::store_( const size_t i )
+{
+  State_& S = node_( i ).S_;
+  S.y0_ = array_( Y0 )[ i ];
+  S.dI_ex_ = array_( DI_EX )[ i ];
+  S.I_ex_ = array_( I_EX )[ i ];
+  S.dI_in_ = array_( DI_IN )[ i ];
+  S.I_in_ = array_( I_IN )[ i ];
+  S.y3_ = array_( Y3 )[ i ];
+  S.r_ = static_cast< int >( array_( R )[ i ] );
+}
+
+void
+iaf_psc_alpha::Batch_::read_input_( const size_t begin, const size_t end, const long from, const long to )
+{
+  for ( size_t i = begin; i < end; ++i )
+  {
+    Buffers_& B = node_( i ).B_;
+    for ( long lag = from; lag < to; ++lag )
+    {
+      const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+      const double* input = B.input_buffer_.get_values_all_channels( input_buffer_slot );
+      input_( Buffers_::SYN_EX, lag )[ i - begin ] = input[ Buffers_::SYN_EX ];
+      input_( Buffers_::SYN_IN, lag )[ i - begin ] = input[ Buffers_::SYN_IN ];
+      input_( Buffers_::I0, lag )[ i - begin ] = input[ Buffers_::I0 ];
+      B.input_buffer_.reset_values_all_channels( input_buffer_slot );
+    }
+  }
+}
+
+void
+iaf_psc_alpha::Batch_::step_( const size_t begin, const size_t end, const long lag )
+{
+  const double* const I_e = array_( I_E ) + begin;
+  const double* const Theta = array_( THETA ) + begin;
+  const double* const V_reset = array_( V_RESET ) + begin;
+  const double* const LowerBound = array_( LOWER_BOUND ) + begin;
+  const double* const RefractoryCounts = array_( REFRACTORY_COUNTS ) + begin;
+  const double* const EPSCInitialValue = array_( EPSC_INITIAL_VALUE ) + begin;
+  const double* const IPSCInitialValue = array_( IPSC_INITIAL_VALUE ) + begin;
+  const double* const p11_ex = array_( P11_EX ) + begin;
+  const double* const p21_ex = array_( P21_EX ) + begin;
+  const double* const p22_ex = array_( P22_EX ) + begin;
+  const double* const p31_ex = array_( P31_EX ) + begin;
+  const double* const p32_ex = array_( P32_EX ) + begin;
+  const double* const p11_in = array_( P11_IN ) + begin;
+  const double* const p21_in = array_( P21_IN ) + begin;
+  const double* const p22_in = array_( P22_IN ) + begin;
+  const double* const p31_in = array_( P31_IN ) + begin;
+  const double* const p32_in = array_( P32_IN ) + begin;
+  const double* const p30 = array_( P30 ) + begin;
+  const double* const expm1_tau_m = array_( EXPM1_TAU_M ) + begin;
+
+  double* const y0 = array_( Y0 ) + begin;
+  double* const dI_ex = array_( DI_EX ) + begin;
+  double* const I_ex = array_( I_EX ) + begin;
+  double* const dI_in = array_( DI_IN ) + begin;
+  double* const I_in = array_( I_IN ) + begin;
+  double* const y3 = array_( Y3 ) + begin;
+  double* const r = array_( R ) + begin;
+  double* const y3_new = array_( Y3_NEW ) + begin;
+
+  const double* const spikes_ex = input_( Buffers_::SYN_EX, lag );
+  const double* const spikes_in = input_( Buffers_::SYN_IN, lag );
+  const double* const current = input_( Buffers_::I0, lag );
+
+  // same arithmetic as iaf_psc_alpha::update(); the propagation of all
+  // neurons is vectorized, refractoriness and threshold are handled in a
+  // second pass
+  const size_t n = end - begin;
+#pragma omp simd
+  for ( size_t j = 0; j < n; ++j )
+  {
+    const double v = p30[ j ] * ( y0[ j ] + I_e[ j ] ) + p31_ex[ j ] * dI_ex[ j ] + p32_ex[ j ] * I_ex[ j ]
+      + p31_in[ j ] * dI_in[ j ] + p32_in[ j ] * I_in[ j ] + expm1_tau_m[ j ] * y3[ j ] + y3[ j ];
+    y3_new[ j ] = v < LowerBound[ j ] ? LowerBound[ j ] : v;
+
+    I_ex[ j ] = p21_ex[ j ] * dI_ex[ j ] + p22_ex[ j ] * I_ex[ j ];
+    dI_ex[ j ] *= p11_ex[ j ];
+    dI_ex[ j ] += EPSCInitialValue[ j ] * spikes_ex[ j ];
+
+    I_in[ j ] = p21_in[ j ] * dI_in[ j ] + p22_in[ j ] * I_in[ j ];
+    dI_in[ j ] *= p11_in[ j ];
+    dI_in[ j ] += IPSCInitialValue[ j ] * spikes_in[ j ];
+
+    y0[ j ] = current[ j ];
+  }
+
+  for ( size_t j = 0; j < n; ++j )
+  {
+    if ( r[ j ] > 0 )
+    {
+      r[ j ] -= 1;
+    }
+    else
+    {
+      y3[ j ] = y3_new[ j ];
+    }
+
+    spike_mask_[ j ] = y3[ j ] >= Theta[ j ];
+    if ( spike_mask_[ j ] )
+    {
+      r[ j ] = RefractoryCounts[ j ];
+      y3[ j ] = V_reset[ j ];
+    }
+  }
+}
+
+void
+iaf_psc_alpha::Batch_::record_( const size_t i, const long step )
+{
+  node_( i ).B_.logger_.record_data( step );
 }
 
 void
@@ -379,8 +644,10 @@ iaf_psc_alpha::handle( SpikeEvent& e )
 {
   assert( e.get_delay_steps() > 0 );
 
-  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo(
-    e.get_rel_delivery_steps( kernel().simulation_manager.get_slice_origin() ) );
+  const Time& slice_origin = kernel().simulation_manager.get_slice_origin();
+  const long rel_delivery_steps = e.get_rel_delivery_steps( slice_origin );
+  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( rel_delivery_steps );
+  B_.last_input_step_ = std::max( B_.last_input_step_, slice_origin.get_steps() + rel_delivery_steps );
 
   const double s = e.get_weight() * e.get_multiplicity();
 
@@ -393,8 +660,10 @@ iaf_psc_alpha::handle( CurrentEvent& e )
 {
   assert( e.get_delay_steps() > 0 );
 
-  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo(
-    e.get_rel_delivery_steps( kernel().simulation_manager.get_slice_origin() ) );
+  const Time& slice_origin = kernel().simulation_manager.get_slice_origin();
+  const long rel_delivery_steps = e.get_rel_delivery_steps( slice_origin );
+  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( rel_delivery_steps );
+  B_.last_input_step_ = std::max( B_.last_input_step_, slice_origin.get_steps() + rel_delivery_steps );
 
   const double I = e.get_current();
   const double w = e.get_weight();
@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_ALPHA_H
 #define IAF_PSC_ALPHA_H
 
+// C++ includes:
+#include <memory>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -68,6 +72,13 @@ Critical tests for the formulation of the neuron model are the
 comparisons of simulation results for different computation step
 sizes and the testsuite contains a number of such tests.
 
+If the kernel property ``lazy_update`` is set, a neuron that receives no input
+and, given its current state, cannot reach threshold or ``V_min`` without
+input, is not updated until input arrives. Its state is then advanced over
+the skipped steps by the exact solution at once. This does not apply to
+neurons with a connected multimeter or that are updated in batches, see
+``vectorized_update``.
+
 The ``iaf_psc_alpha`` is the standard model used to check the consistency
 of the nest simulation kernel because it is at the same time complex
 enough to exhibit non-trivial dynamics and simple enough compute
@@ -179,12 +190,30 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void post_run_cleanup();
+
 private:
   void init_buffers_();
   void calibrate();
 
   void update( Time const&, const long, const long );
 
+  bool supports_batch_update() const;
+  NodeBatch* create_batch() const;
+
+  /**
+   * Return true if the neuron has no input from the given step on and
+   * cannot reach threshold or the lower bound of the membrane potential
+   * without input, so that its update can be skipped.
+   */
+  bool is_quiescent_( const long step ) const;
+
+  /**
+   * Advance the state of a neuron whose update has been skipped to the
+   * beginning of the given step and resume updating it.
+   */
+  void wake_up_( const long step );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
@@ -283,12 +312,21 @@ private:
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_alpha > logger_;
+
+    //! Last step in which input from events takes effect, -1 if none
+    long last_input_step_;
   };
 
   // ----------------------------------------------------------------
 
-  struct Variables_
+  /**
+   * Propagators and other quantities computed from the parameters and the
+   * resolution. Neurons with identical parameters share one instance, see
+   * PropagatorCache.
+   */
+  struct Propagators_
   {
+    explicit Propagators_( const Parameters_& );
 
     /** Amplitude of the synaptic current.
         This value is chosen such that a postsynaptic potential with
@@ -311,9 +349,77 @@ private:
     double P30_;
     double P33_;
     double expm1_tau_m_;
+  };
+
+  // ----------------------------------------------------------------
+
+  struct Variables_
+  {
+    std::shared_ptr< const Propagators_ > propagators_;
 
     double weighted_spikes_ex_;
     double weighted_spikes_in_;
+
+    //! Step from which the update has been skipped, -1 if the neuron is updated
+    long dormant_step_;
+  };
+
+  // ----------------------------------------------------------------
+
+  /**
+   * Batch of neurons updated together, with propagators and state stored as
+   * arrays over the neurons.
+   */
+  class Batch_ : public NodeBatch
+  {
+  public:
+    Batch_();
+
+  private:
+    //! Indices of the arrays over the neurons
+    enum
+    {
+      I_E = 0,
+      THETA,
+      V_RESET,
+      LOWER_BOUND,
+      REFRACTORY_COUNTS,
+      EPSC_INITIAL_VALUE,
+      IPSC_INITIAL_VALUE,
+      P11_EX,
+      P21_EX,
+      P22_EX,
+      P31_EX,
+      P32_EX,
+      P11_IN,
+      P21_IN,
+      P22_IN,
+      P31_IN,
+      P32_IN,
+      P30,
+      EXPM1_TAU_M,
+      Y0,
+      DI_EX,
+      I_EX,
+      DI_IN,
+      I_IN,
+      Y3,
+      R, //!< refractory counter, stored as double like all arrays
+      Y3_NEW, //!< membrane potential of the step if not refractory
+      NUM_ARRAYS
+    };
+
+    iaf_psc_alpha&
+    node_( const size_t i ) const
+    {
+      return *static_cast< iaf_psc_alpha* >( nodes_[ i ] );
+    }
+
+    void load_( const size_t );
+    void store_( const size_t );
+    void read_input_( const size_t, const size_t, const long, const long );
+    void step_( const size_t, const size_t, const long );
+    void record_( const size_t, const long );
   };
 
   // Access functions for UniversalDataLogger -------------------------------
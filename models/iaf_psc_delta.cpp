@@ -330,6 +330,129 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   }
 }
 
+bool
+nest::iaf_psc_delta::supports_batch_update() const
+{
+  // discounting refractory input requires an exponential per neuron and step
+  return not P_.with_refr_input_;
+}
+
+nest::NodeBatch*
+nest::iaf_psc_delta::create_batch() const
+{
+  return new Batch_();
+}
+
+nest::iaf_psc_delta::Batch_::Batch_()
+  : NodeBatch( NUM_ARRAYS, NUM_INPUT_CHANNELS )
+{
+}
+
+void
+nest::iaf_psc_delta::Batch_::load_( const size_t i )
+{
+  const iaf_psc_delta& node = node_( i );
+
+  array_( I_E )[ i ] = node.P_.I_e_;
+  array_( V_TH )[ i ] = node.P_.V_th_;
+  array_( V_RESET )[ i ] = node.P_.V_reset_;
+  array_( V_MIN )[ i ] = node.P_.V_min_;
+  array_( REFRACTORY_COUNTS )[ i ] = node.V_.RefractoryCounts_;
+
+  array_( P30 )[ i ] = node.V_.P30_;
+  array_( P33 )[ i ] = node.V_.P33_;
+
+  array_( Y0 )[ i ] = node.S_.y0_;
+  array_( Y3 )[ i ] = node.S_.y3_;
+  array_( R )[ i ] = node.S_.r_;
+
+  if ( node.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( i );
+  }
+}
+
+void
+nest::iaf_psc_delta::Batch_::store_( const size_t i )
+{
+  State_& S = node_( i ).S_;
+  S.y0_ = array_( Y0 )[ i ];
+  S.y3_ = array_( Y3 )[ i ];
+  S.r_ = static_cast< int >( array_( R )[ i ] );
+}
+
+void
+nest::iaf_psc_delta::Batch_::read_input_( const size_t begin, const size_t end, const long from, const long to )
+{
+  for ( size_t i = begin; i < end; ++i )
+  {
+    Buffers_& B = node_( i ).B_;
+    for ( long lag = from; lag < to; ++lag )
+    {
+      input_( SPIKES, lag )[ i - begin ] = B.spikes_.get_value( lag );
+      input_( CURRENTS, lag )[ i - begin ] = B.currents_.get_value( lag );
+    }
+  }
+}
+
+void
+nest::iaf_psc_delta::Batch_::step_( const size_t begin, const size_t end, const long lag )
+{
+  const double* const I_e = array_( I_E ) + begin;
+  const double* const V_th = array_( V_TH ) + begin;
+  const double* const V_reset = array_( V_RESET ) + begin;
+  const double* const V_min = array_( V_MIN ) + begin;
+  const double* const RefractoryCounts = array_( REFRACTORY_COUNTS ) + begin;
+  const double* const p30 = array_( P30 ) + begin;
+  const double* const p33 = array_( P33 ) + begin;
+
+  double* const y0 = array_( Y0 ) + begin;
+  double* const y3 = array_( Y3 ) + begin;
+  double* const r = array_( R ) + begin;
+  double* const y3_new = array_( Y3_NEW ) + begin;
+
+  const double* const spikes = input_( SPIKES, lag );
+  const double* const currents = input_( CURRENTS, lag );
+
+  // same arithmetic as iaf_psc_delta::update(); the propagation of all
+  // neurons is vectorized, refractoriness and threshold are handled in a
+  // second pass, which ignores spikes arriving during the refractory period
+  const size_t n = end - begin;
+#pragma omp simd
+  for ( size_t j = 0; j < n; ++j )
+  {
+    const double v = p30[ j ] * ( y0[ j ] + I_e[ j ] ) + p33[ j ] * y3[ j ] + spikes[ j ];
+    y3_new[ j ] = v < V_min[ j ] ? V_min[ j ] : v;
+
+    y0[ j ] = currents[ j ];
+  }
+
+  for ( size_t j = 0; j < n; ++j )
+  {
+    if ( r[ j ] > 0 )
+    {
+      r[ j ] -= 1;
+    }
+    else
+    {
+      y3[ j ] = y3_new[ j ];
+    }
+
+    spike_mask_[ j ] = y3[ j ] >= V_th[ j ];
+    if ( spike_mask_[ j ] )
+    {
+      r[ j ] = RefractoryCounts[ j ];
+      y3[ j ] = V_reset[ j ];
+    }
+  }
+}
+
+void
+nest::iaf_psc_delta::Batch_::record_( const size_t i, const long step )
+{
+  node_( i ).B_.logger_.record_data( step );
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
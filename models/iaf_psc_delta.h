@@ -28,6 +28,7 @@
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
 
@@ -175,6 +176,9 @@ private:
 
   void update( Time const&, const long, const long );
 
+  bool supports_batch_update() const;
+  NodeBatch* create_batch() const;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
@@ -287,6 +291,56 @@ private:
     int RefractoryCounts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Batch of neurons without refractory input updated together, with
+   * propagators and state stored as arrays over the neurons.
+   */
+  class Batch_ : public NodeBatch
+  {
+  public:
+    Batch_();
+
+  private:
+    //! Indices of the arrays over the neurons
+    enum
+    {
+      I_E = 0,
+      V_TH,
+      V_RESET,
+      V_MIN,
+      REFRACTORY_COUNTS,
+      P30,
+      P33,
+      Y0,
+      Y3,
+      R, //!< refractory counter, stored as double like all arrays
+      Y3_NEW, //!< membrane potential of the step if not refractory
+      NUM_ARRAYS
+    };
+
+    //! Indices of the input channels
+    enum
+    {
+      SPIKES = 0,
+      CURRENTS,
+      NUM_INPUT_CHANNELS
+    };
+
+    iaf_psc_delta&
+    node_( const size_t i ) const
+    {
+      return *static_cast< iaf_psc_delta* >( nodes_[ i ] );
+    }
+
+    void load_( const size_t );
+    void store_( const size_t );
+    void read_input_( const size_t, const size_t, const long, const long );
+    void step_( const size_t, const size_t, const long );
+    void record_( const size_t, const long );
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
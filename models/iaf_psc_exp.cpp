@@ -23,6 +23,7 @@
 #include "iaf_psc_exp.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -199,11 +200,13 @@ nest::iaf_psc_exp::State_::set( const DictionaryDatum& d, const Parameters_& p,
 
 nest::iaf_psc_exp::Buffers_::Buffers_( iaf_psc_exp& n )
   : logger_( n )
+  , last_input_step_( -1 )
 {
 }
 
 nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
   : logger_( n )
+  , last_input_step_( -1 )
 {
 }
 
@@ -218,6 +221,7 @@ nest::iaf_psc_exp::iaf_psc_exp()
   , B_( *this )
 {
   recordablesMap_.create();
+  V_.dormant_step_ = -1;
 }
 
 nest::iaf_psc_exp::iaf_psc_exp( const iaf_psc_exp& n )
@@ -226,6 +230,7 @@ nest::iaf_psc_exp::iaf_psc_exp( const iaf_psc_exp& n )
   , S_( n.S_ )
   , B_( n.B_, *this )
 {
+  V_.dormant_step_ = -1;
 }
 
 /* ----------------------------------------------------------------
@@ -236,29 +241,26 @@ void
 nest::iaf_psc_exp::init_buffers_()
 {
   B_.input_buffer_.clear(); // includes resize
+  B_.last_input_step_ = -1;
   B_.logger_.reset();
   ArchivingNode::clear_history();
 }
 
-void
-nest::iaf_psc_exp::calibrate()
+nest::iaf_psc_exp::Propagators_::Propagators_( const Parameters_& p )
 {
-  // ensures initialization in case mm connected after Simulate
-  B_.logger_.init();
-
   const double h = Time::get_resolution().get_ms();
 
   // these P are independent
-  V_.P11ex_ = std::exp( -h / P_.tau_ex_ );
-  V_.P11in_ = std::exp( -h / P_.tau_in_ );
+  P11ex_ = std::exp( -h / p.tau_ex_ );
+  P11in_ = std::exp( -h / p.tau_in_ );
 
-  V_.P22_ = std::exp( -h / P_.Tau_ );
+  P22_ = std::exp( -h / p.Tau_ );
 
   // these are determined according to a numeric stability criterion
-  V_.P21ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P21in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
+  P21ex_ = propagator_32( p.tau_ex_, p.Tau_, p.C_, h );
+  P21in_ = propagator_32( p.tau_in_, p.Tau_, p.C_, h );
 
-  V_.P20_ = P_.Tau_ / P_.C_ * ( 1.0 - V_.P22_ );
+  P20_ = p.Tau_ / p.C_ * ( 1.0 - P22_ );
 
   // t_ref_ specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_exp can only handle refractory
@@ -277,11 +279,23 @@ nest::iaf_psc_exp::calibrate()
   // results. However, a neuron model capable of operating with real valued
   // spike time may exhibit a different effective refractory time.
 
-  V_.RefractoryCounts_ = Time( Time::ms( P_.t_ref_ ) ).get_steps();
+  RefractoryCounts_ = Time( Time::ms( p.t_ref_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
-  assert( V_.RefractoryCounts_ >= 0 );
+  assert( RefractoryCounts_ >= 0 );
+}
+
+void
+nest::iaf_psc_exp::calibrate()
+{
+  // ensures initialization in case mm connected after Simulate
+  B_.logger_.init();
+
+  // neurons with identical parameters share their propagators
+  V_.propagators_ = kernel().node_manager.get_propagator_cache().get< Propagators_ >(
+    get_thread(), { P_.Tau_, P_.C_, P_.t_ref_, P_.tau_ex_, P_.tau_in_ }, P_ );
 
   V_.rng_ = get_vp_specific_rng( get_thread() );
+  V_.dormant_step_ = -1;
 }
 
 void
@@ -290,7 +304,19 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( V_.dormant_step_ >= 0 )
+  {
+    const long slice_begin = origin.get_steps() + from;
+    if ( B_.last_input_step_ < slice_begin )
+    {
+      // still no input, so the neuron cannot reach threshold
+      return;
+    }
+    wake_up_( slice_begin );
+  }
+
   const double h = Time::get_resolution().get_ms();
+  const Propagators_& prop = *V_.propagators_;
 
   // evolve from timestep 'from' to timestep 'to' with steps of h each
   for ( long lag = from; lag < to; ++lag )
@@ -298,7 +324,7 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
     {
       S_.V_m_ =
-        S_.V_m_ * V_.P22_ + S_.i_syn_ex_ * V_.P21ex_ + S_.i_syn_in_ * V_.P21in_ + ( P_.I_e_ + S_.i_0_ ) * V_.P20_;
+        S_.V_m_ * prop.P22_ + S_.i_syn_ex_ * prop.P21ex_ + S_.i_syn_in_ * prop.P21in_ + ( P_.I_e_ + S_.i_0_ ) * prop.P20_;
     }
     else
     {
@@ -307,15 +333,15 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     }
 
     // exponential decaying PSCs
-    S_.i_syn_ex_ *= V_.P11ex_;
-    S_.i_syn_in_ *= V_.P11in_;
+    S_.i_syn_ex_ *= prop.P11ex_;
+    S_.i_syn_in_ *= prop.P11in_;
 
     // add evolution of presynaptic input current
-    S_.i_syn_ex_ += ( 1. - V_.P11ex_ ) * S_.i_1_;
+    S_.i_syn_ex_ += ( 1. - prop.P11ex_ ) * S_.i_1_;
 
     // get read access to the correct input-buffer slot
     const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
-    auto& input = B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+    const double* input = B_.input_buffer_.get_values_all_channels( input_buffer_slot );
 
     // the spikes arriving at T+1 have an immediate effect on the state of the
     // neuron
@@ -329,7 +355,7 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     if ( ( P_.delta_ < 1e-10 and S_.V_m_ >= P_.Theta_ )                   // deterministic threshold crossing
       or ( P_.delta_ > 1e-10 and V_.rng_->drand() < phi_() * h * 1e-3 ) ) // stochastic threshold crossing
     {
-      S_.r_ref_ = V_.RefractoryCounts_;
+      S_.r_ref_ = prop.RefractoryCounts_;
       S_.V_m_ = P_.V_reset_;
 
       set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
@@ -348,6 +374,211 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     // log state data
     B_.logger_.record_data( origin.get_steps() + lag );
   }
+
+  if ( kernel().simulation_manager.lazy_update() and is_quiescent_( origin.get_steps() + to ) )
+  {
+    V_.dormant_step_ = origin.get_steps() + to;
+  }
+}
+
+bool
+nest::iaf_psc_exp::is_quiescent_( const long step ) const
+{
+  // the current inputs are only constant while the neuron receives them, so
+  // they must have ended
+  if ( S_.r_ref_ > 0 or S_.i_0_ != 0. or S_.i_1_ != 0. or P_.delta_ > 1e-10 or B_.last_input_step_ >= step
+    or B_.logger_.has_loggers() )
+  {
+    return false;
+  }
+
+  // Without input, the membrane potential relaxes to V_inf and the synaptic
+  // currents decay. A positive current i_syn raises the membrane potential by
+  // less than its integral tau_syn * i_syn / C.
+  const double V_inf = P_.Tau_ / P_.C_ * P_.I_e_;
+  const double V_max = std::max( S_.V_m_, V_inf )
+    + ( P_.tau_ex_ * std::max( S_.i_syn_ex_, 0. ) + P_.tau_in_ * std::max( S_.i_syn_in_, 0. ) ) / P_.C_;
+  return V_max < P_.Theta_;
+}
+
+void
+nest::iaf_psc_exp::wake_up_( const long step )
+{
+  assert( step >= V_.dormant_step_ );
+
+  // exact solution of the dynamics without input over the skipped steps
+  const double t = Time::get_resolution().get_ms() * ( step - V_.dormant_step_ );
+  const double V_inf = P_.Tau_ / P_.C_ * P_.I_e_;
+  S_.V_m_ = V_inf + ( S_.V_m_ - V_inf ) * std::exp( -t / P_.Tau_ )
+    + propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, t ) * S_.i_syn_ex_
+    + propagator_32( P_.tau_in_, P_.Tau_, P_.C_, t ) * S_.i_syn_in_;
+  S_.i_syn_ex_ *= std::exp( -t / P_.tau_ex_ );
+  S_.i_syn_in_ *= std::exp( -t / P_.tau_in_ );
+
+  V_.dormant_step_ = -1;
+}
+
+void
+nest::iaf_psc_exp::post_run_cleanup()
+{
+  // bring the state up to date, so that it can be inspected
+  if ( V_.dormant_step_ >= 0 )
+  {
+    wake_up_( kernel().simulation_manager.get_time().get_steps() );
+  }
+}
+
+bool
+nest::iaf_psc_exp::supports_batch_update() const
+{
+  // the stochastic threshold requires random numbers drawn in order
+  return P_.delta_ < 1e-10;
+}
+
+nest::NodeBatch*
+nest::iaf_psc_exp::create_batch() const
+{
+  return new Batch_();
+}
+
+nest::iaf_psc_exp::Batch_::Batch_()
+  : NodeBatch( NUM_ARRAYS, Buffers_::NUM_INPUT_CHANNELS )
+{
+}
+
+void
+nest::iaf_psc_exp::Batch_::load_( const size_t i )
+{
+  const iaf_psc_exp& node = node_( i );
+  const Propagators_& prop = *node.V_.propagators_;
+
+  array_( I_E )[ i ] = node.P_.I_e_;
+  array_( THETA )[ i ] = node.P_.Theta_;
+  array_( V_RESET )[ i ] = node.P_.V_reset_;
+  array_( REFRACTORY_COUNTS )[ i ] = prop.RefractoryCounts_;
+
+  array_( P20 )[ i ] = prop.P20_;
+  array_( P11EX )[ i ] = prop.P11ex_;
+  array_( P11IN )[ i ] = prop.P11in_;
+  array_( P21EX )[ i ] = prop.P21ex_;
+  array_( P21IN )[ i ] = prop.P21in_;
+  array_( P22 )[ i ] = prop.P22_;
+
+  array_( I_0 )[ i ] = node.S_.i_0_;
+  array_( I_1 )[ i ] = node.S_.i_1_;
+  array_( I_SYN_EX )[ i ] = node.S_.i_syn_ex_;
+  array_( I_SYN_IN )[ i ] = node.S_.i_syn_in_;
+  array_( V_M )[ i ] = node.S_.V_m_;
+  array_( R_REF )[ i ] = node.S_.r_ref_;
+
+  if ( node.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( i );
+  }
+}
+
+void
+nest::iaf_psc_exp::Batch_::store_( const size_t i )
+{
+  State_& S = node_( i ).S_;
+  S.i_0_ = array_( I_0 )[ i ];
+  S.i_1_ = array_( I_1 )[ i ];
+  S.i_syn_ex_ = array_( I_SYN_EX )[ i ];
+  S.i_syn_in_ = array_( I_SYN_IN )[ i ];
+  S.V_m_ = array_( V_M )[ i ];
+  S.r_ref_ = static_cast< int >( array_( R_REF )[ i ] );
+}
+
+void
+nest::iaf_psc_exp::Batch_::read_input_( const size_t begin, const size_t end, const long from, const long to )
+{
+  for ( size_t i = begin; i < end; ++i )
+  {
+    Buffers_& B = node_( i ).B_;
+    for ( long lag = from; lag < to; ++lag )
+    {
+      const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+      const double* input = B.input_buffer_.get_values_all_channels( input_buffer_slot );
+      input_( Buffers_::SYN_EX, lag )[ i - begin ] = input[ Buffers_::SYN_EX ];
+      input_( Buffers_::SYN_IN, lag )[ i - begin ] = input[ Buffers_::SYN_IN ];
+      input_( Buffers_::I0, lag )[ i - begin ] = input[ Buffers_::I0 ];
+      input_( Buffers_::I1, lag )[ i - begin ] = input[ Buffers_::I1 ];
+      B.input_buffer_.reset_values_all_channels( input_buffer_slot );
+    }
+  }
+}
+
+void
+nest::iaf_psc_exp::Batch_::step_( const size_t begin, const size_t end, const long lag )
+{
+  const double* const I_e = array_( I_E ) + begin;
+  const double* const Theta = array_( THETA ) + begin;
+  const double* const V_reset = array_( V_RESET ) + begin;
+  const double* const RefractoryCounts = array_( REFRACTORY_COUNTS ) + begin;
+  const double* const p20 = array_( P20 ) + begin;
+  const double* const p11ex = array_( P11EX ) + begin;
+  const double* const p11in = array_( P11IN ) + begin;
+  const double* const p21ex = array_( P21EX ) + begin;
+  const double* const p21in = array_( P21IN ) + begin;
+  const double* const p22 = array_( P22 ) + begin;
+
+  double* const i_0 = array_( I_0 ) + begin;
+  double* const i_1 = array_( I_1 ) + begin;
+  double* const i_syn_ex = array_( I_SYN_EX ) + begin;
+  double* const i_syn_in = array_( I_SYN_IN ) + begin;
+  double* const V_m = array_( V_M ) + begin;
+  double* const r_ref = array_( R_REF ) + begin;
+  double* const V_m_new = array_( V_M_NEW ) + begin;
+
+  const double* const spikes_ex = input_( Buffers_::SYN_EX, lag );
+  const double* const spikes_in = input_( Buffers_::SYN_IN, lag );
+  const double* const current_0 = input_( Buffers_::I0, lag );
+  const double* const current_1 = input_( Buffers_::I1, lag );
+
+  // same arithmetic as iaf_psc_exp::update(); the propagation of all
+  // neurons is vectorized, refractoriness and threshold are handled in a
+  // second pass
+  const size_t n = end - begin;
+#pragma omp simd
+  for ( size_t j = 0; j < n; ++j )
+  {
+    V_m_new[ j ] =
+      V_m[ j ] * p22[ j ] + i_syn_ex[ j ] * p21ex[ j ] + i_syn_in[ j ] * p21in[ j ] + ( I_e[ j ] + i_0[ j ] ) * p20[ j ];
+
+    i_syn_ex[ j ] *= p11ex[ j ];
+    i_syn_in[ j ] *= p11in[ j ];
+    i_syn_ex[ j ] += ( 1. - p11ex[ j ] ) * i_1[ j ];
+    i_syn_ex[ j ] += spikes_ex[ j ];
+    i_syn_in[ j ] += spikes_in[ j ];
+
+    i_0[ j ] = current_0[ j ];
+    i_1[ j ] = current_1[ j ];
+  }
+
+  for ( size_t j = 0; j < n; ++j )
+  {
+    if ( r_ref[ j ] > 0 )
+    {
+      r_ref[ j ] -= 1;
+    }
+    else
+    {
+      V_m[ j ] = V_m_new[ j ];
+    }
+
+    spike_mask_[ j ] = V_m[ j ] >= Theta[ j ];
+    if ( spike_mask_[ j ] )
+    {
+      r_ref[ j ] = RefractoryCounts[ j ];
+      V_m[ j ] = V_reset[ j ];
+    }
+  }
+}
+
+void
+nest::iaf_psc_exp::Batch_::record_( const size_t i, const long step )
+{
+  node_( i ).B_.logger_.record_data( step );
 }
 
 void
@@ -355,8 +586,10 @@ nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
   assert( e.get_delay_steps() > 0 );
 
-  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo(
-    e.get_rel_delivery_steps( kernel().simulation_manager.get_slice_origin() ) );
+  const Time& slice_origin = kernel().simulation_manager.get_slice_origin();
+  const long rel_delivery_steps = e.get_rel_delivery_steps( slice_origin );
+  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( rel_delivery_steps );
+  B_.last_input_step_ = std::max( B_.last_input_step_, slice_origin.get_steps() + rel_delivery_steps );
 
   const double s = e.get_weight() * e.get_multiplicity();
 
@@ -372,8 +605,10 @@ nest::iaf_psc_exp::handle( CurrentEvent& e )
   const double c = e.get_current();
   const double w = e.get_weight();
 
-  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo(
-    e.get_rel_delivery_steps( kernel().simulation_manager.get_slice_origin() ) );
+  const Time& slice_origin = kernel().simulation_manager.get_slice_origin();
+  const long rel_delivery_steps = e.get_rel_delivery_steps( slice_origin );
+  const index input_buffer_slot = kernel().event_delivery_manager.get_modulo( rel_delivery_steps );
+  B_.last_input_step_ = std::max( B_.last_input_step_, slice_origin.get_steps() + rel_delivery_steps );
 
   if ( 0 == e.get_rport() )
   {
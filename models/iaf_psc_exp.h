@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_EXP_H
 #define IAF_PSC_EXP_H
 
+// C++ includes:
+#include <memory>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -99,6 +103,13 @@ model with escape noise [4]_.
    the sum of excitatory synaptic input current and the contribution from
    receptor type 1 currents.
 
+If the kernel property ``lazy_update`` is set, a neuron with deterministic
+threshold that receives no input and, given its current state, cannot reach
+threshold without input, is not updated until input arrives. Its state is then
+advanced over the skipped steps by the exact solution at once. This does not
+apply to neurons with a connected multimeter or that are updated in batches,
+see ``vectorized_update``.
+
 For conversion between postsynaptic potentials (PSPs) and PSCs,
 please refer to the ``postsynaptic_potential_to_current`` function in
 :doc:`PyNEST Microcircuit: Helper Functions <../auto_examples/Potjans_2014/helpers>`.
@@ -202,12 +213,29 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void post_run_cleanup();
+
 private:
   void init_buffers_();
   void calibrate();
 
   void update( const Time&, const long, const long );
 
+  bool supports_batch_update() const;
+  NodeBatch* create_batch() const;
+
+  /**
+   * Return true if the neuron has no input from the given step on and
+   * cannot reach threshold without input, so that its update can be skipped.
+   */
+  bool is_quiescent_( const long step ) const;
+
+  /**
+   * Advance the state of a neuron whose update has been skipped to the
+   * beginning of the given step and resume updating it.
+   */
+  void wake_up_( const long step );
+
   // intensity function
   double phi_() const;
 
@@ -319,6 +347,31 @@ private:
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_exp > logger_;
+
+    //! Last step in which input from events takes effect, -1 if none
+    long last_input_step_;
+  };
+
+  // ----------------------------------------------------------------
+
+  /**
+   * Propagators and other quantities computed from the parameters and the
+   * resolution. Neurons with identical parameters share one instance, see
+   * PropagatorCache.
+   */
+  struct Propagators_
+  {
+    explicit Propagators_( const Parameters_& );
+
+    // time evolution operator
+    double P20_;
+    double P11ex_;
+    double P11in_;
+    double P21ex_;
+    double P21in_;
+    double P22_;
+
+    int RefractoryCounts_;
   };
 
   // ----------------------------------------------------------------
@@ -335,20 +388,63 @@ private:
     */
     //    double PSCInitialValue_;
 
-    // time evolution operator
-    double P20_;
-    double P11ex_;
-    double P11in_;
-    double P21ex_;
-    double P21in_;
-    double P22_;
+    std::shared_ptr< const Propagators_ > propagators_;
 
     double weighted_spikes_ex_;
     double weighted_spikes_in_;
 
-    int RefractoryCounts_;
-
     RngPtr rng_; //!< random number generator of my own thread
+
+    //! Step from which the update has been skipped, -1 if the neuron is updated
+    long dormant_step_;
+  };
+
+  // ----------------------------------------------------------------
+
+  /**
+   * Batch of neurons with deterministic threshold updated together, with
+   * propagators and state stored as arrays over the neurons.
+   */
+  class Batch_ : public NodeBatch
+  {
+  public:
+    Batch_();
+
+  private:
+    //! Indices of the arrays over the neurons
+    enum
+    {
+      I_E = 0,
+      THETA,
+      V_RESET,
+      REFRACTORY_COUNTS,
+      P20,
+      P11EX,
+      P11IN,
+      P21EX,
+      P21IN,
+      P22,
+      I_0,
+      I_1,
+      I_SYN_EX,
+      I_SYN_IN,
+      V_M,
+      R_REF, //!< refractory counter, stored as double like all arrays
+      V_M_NEW, //!< membrane potential of the step if not refractory
+      NUM_ARRAYS
+    };
+
+    iaf_psc_exp&
+    node_( const size_t i ) const
+    {
+      return *static_cast< iaf_psc_exp* >( nodes_[ i ] );
+    }
+
+    void load_( const size_t );
+    void store_( const size_t );
+    void read_input_( const size_t, const size_t, const long, const long );
+    void step_( const size_t, const size_t, const long );
+    void record_( const size_t, const long );
   };
 
   // Access functions for UniversalDataLogger -------------------------------
@@ -308,6 +308,32 @@ iaf_psc_exp_multisynapse::update( const Time& origin, const long from, const lon
   assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  switch ( P_.n_receptors_() )
+  {
+  case 1:
+    update_< 1 >( origin, from, to );
+    break;
+  case 2:
+    update_< 2 >( origin, from, to );
+    break;
+  case 3:
+    update_< 3 >( origin, from, to );
+    break;
+  case 4:
+    update_< 4 >( origin, from, to );
+    break;
+  default:
+    update_< 0 >( origin, from, to );
+  }
+}
+
+template < size_t N >
+void
+iaf_psc_exp_multisynapse::update_( const Time& origin, const long from, const long to )
+{
+  assert( N == 0 or N == P_.n_receptors_() );
+  const size_t n_receptors = N > 0 ? N : P_.n_receptors_();
+
   // evolve from timestep 'from' to timestep 'to' with steps of h each
   for ( long lag = from; lag < to; ++lag )
   {
@@ -316,7 +342,7 @@ iaf_psc_exp_multisynapse::update( const Time& origin, const long from, const lon
       S_.V_m_ = S_.V_m_ * V_.P22_ + ( P_.I_e_ + S_.I_const_ ) * V_.P20_; // not sure about this
 
       S_.current_ = 0.0;
-      for ( size_t i = 0; i < P_.n_receptors_(); i++ )
+      for ( size_t i = 0; i < n_receptors; i++ )
       {
         S_.V_m_ += V_.P21_syn_[ i ] * S_.i_syn_[ i ];
         S_.current_ += S_.i_syn_[ i ]; // not sure about this
@@ -326,7 +352,7 @@ iaf_psc_exp_multisynapse::update( const Time& origin, const long from, const lon
     {
       --S_.refractory_steps_; // neuron is absolute refractory
     }
-    for ( size_t i = 0; i < P_.n_receptors_(); i++ )
+    for ( size_t i = 0; i < n_receptors; i++ )
     {
       // exponential decaying PSCs
       S_.i_syn_[ i ] *= V_.P11_syn_[ i ];
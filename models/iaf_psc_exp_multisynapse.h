@@ -121,6 +121,14 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Update with N receptors, or any number of receptors if N is 0.
+   * Instances with N > 0 have loops over receptors of fixed length, which
+   * the compiler unrolls, and are used by update() for up to four receptors.
+   */
+  template < size_t N >
+  void update_( Time const&, const long, const long );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class DynamicRecordablesMap< iaf_psc_exp_multisynapse >;
   friend class DynamicUniversalDataLogger< iaf_psc_exp_multisynapse >;
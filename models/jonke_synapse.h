@@ -342,8 +342,8 @@ jonke_synapse< targetidentifierT >::send( Event& e, thread t, const JonkeCommonP
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
@@ -94,6 +94,7 @@ nest::siegert_neuron::Parameters_::Parameters_()
   , mean_( 0.0 )    // 1/ms
   , theta_( 15.0 )  // mV, rel to E_L_
   , V_reset_( 0.0 ) // mV, rel to E_L_
+  , interpolation_tol_( 0.0 )
 {
 }
 
@@ -117,6 +118,7 @@ nest::siegert_neuron::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::tau_m, tau_m_ );
   def< double >( d, names::tau_syn, tau_syn_ );
   def< double >( d, names::t_ref, t_ref_ );
+  def< double >( d, names::interpolation_tol, interpolation_tol_ );
 }
 
 void
@@ -129,6 +131,7 @@ nest::siegert_neuron::Parameters_::set( const DictionaryDatum& d, Node* node )
   updateValueParam< double >( d, names::tau_m, tau_m_, node );
   updateValueParam< double >( d, names::tau_syn, tau_syn_, node );
   updateValueParam< double >( d, names::t_ref, t_ref_, node );
+  updateValueParam< double >( d, names::interpolation_tol, interpolation_tol_, node );
 
   if ( V_reset_ >= theta_ )
   {
@@ -154,6 +157,11 @@ nest::siegert_neuron::Parameters_::set( const DictionaryDatum& d, Node* node )
   {
     throw BadProperty( "Membrane time constant must not be negative." );
   }
+
+  if ( interpolation_tol_ < 0 )
+  {
+    throw BadProperty( "Interpolation tolerance must not be negative." );
+  }
 }
 
 void
@@ -214,6 +222,19 @@ nest::siegert_neuron::~siegert_neuron()
 
 double
 nest::siegert_neuron::siegert( double mu, double sigma_square )
+{
+  if ( V_.siegert_table_ )
+  {
+    return V_.siegert_table_->rate( mu, sigma_square );
+  }
+  return siegert_( P_, gsl_w_, mu, sigma_square );
+}
+
+double
+nest::siegert_neuron::siegert_( const Parameters_& P_,
+  gsl_integration_workspace* gsl_w_,
+  double mu,
+  double sigma_square )
 {
   double sigma = std::sqrt( sigma_square );
 
@@ -274,6 +295,110 @@ nest::siegert_neuron::siegert( double mu, double sigma_square )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Interpolated Siegert function
+ * ---------------------------------------------------------------- */
+
+nest::siegert_neuron::SiegertTable_::SiegertTable_( const Parameters_& p )
+  : P_( p )
+  , spacing_( ( p.theta_ - p.V_reset_ ) / 4. )
+  , cells_()
+  , gsl_w_( gsl_integration_workspace_alloc( 1000 ) )
+{
+}
+
+nest::siegert_neuron::SiegertTable_::~SiegertTable_()
+{
+  gsl_integration_workspace_free( gsl_w_ );
+}
+
+bool
+nest::siegert_neuron::SiegertTable_::matches( const Parameters_& p ) const
+{
+  return p.tau_m_ == P_.tau_m_ and p.tau_syn_ == P_.tau_syn_ and p.t_ref_ == P_.t_ref_ and p.theta_ == P_.theta_
+    and p.V_reset_ == P_.V_reset_ and p.interpolation_tol_ == P_.interpolation_tol_;
+}
+
+double
+nest::siegert_neuron::SiegertTable_::rate( const double mu, const double sigma_square ) const
+{
+  if ( sigma_square > 0. )
+  {
+    const double sigma = std::sqrt( sigma_square );
+    double h = spacing_;
+    for ( long level = 0; level < num_levels_; ++level, h /= 2. )
+    {
+      const double x = mu / h;
+      const double y = sigma / h;
+      const CellIndex_ index = { level, static_cast< long >( std::floor( x ) ), static_cast< long >( std::floor( y ) ) };
+
+      auto it = cells_.find( index );
+      if ( it == cells_.end() )
+      {
+        if ( cells_.size() >= max_cells_ )
+        {
+          break;
+        }
+
+        // Compute at most one new cell per call. If it is rejected, the next
+        // level is only tried by later calls for inputs in the same cell.
+        it = insert_cell_( index );
+        if ( not it->second.accepted )
+        {
+          break;
+        }
+      }
+
+      if ( it->second.accepted )
+      {
+        return interpolate_( it->second, x - index.i, y - index.j );
+      }
+    }
+  }
+
+  return siegert_( P_, gsl_w_, mu, sigma_square );
+}
+
+nest::siegert_neuron::SiegertTable_::CellMap_::iterator
+nest::siegert_neuron::SiegertTable_::insert_cell_( const CellIndex_& index ) const
+{
+  Cell_ cell;
+  cell.accepted = false;
+  if ( index.j > 0 )
+  {
+    const double h = spacing_ / ( 1L << index.level );
+    auto exact = [ this, h, &index ]( const double x, const double y )
+    {
+      const double sigma = ( index.j + y ) * h;
+      return siegert_( P_, gsl_w_, ( index.i + x ) * h, sigma * sigma );
+    };
+
+    cell.corners[ 0 ] = exact( 0., 0. );
+    cell.corners[ 1 ] = exact( 1., 0. );
+    cell.corners[ 2 ] = exact( 0., 1. );
+    cell.corners[ 3 ] = exact( 1., 1. );
+
+    // the error is largest away from the corners
+    const double checks[ 5 ][ 2 ] = { { 0.5, 0.5 }, { 0.5, 0. }, { 0.5, 1. }, { 0., 0.5 }, { 1., 0.5 } };
+    cell.accepted = true;
+    for ( size_t k = 0; k < 5 and cell.accepted; ++k )
+    {
+      const double error = std::abs( interpolate_( cell, checks[ k ][ 0 ], checks[ k ][ 1 ] ) - exact( checks[ k ][ 0 ], checks[ k ][ 1 ] ) );
+      // not accepted if the error is NaN
+      cell.accepted = error <= P_.interpolation_tol_;
+    }
+  }
+
+  return cells_.insert( std::make_pair( index, cell ) ).first;
+}
+
+double
+nest::siegert_neuron::SiegertTable_::interpolate_( const Cell_& cell, const double x, const double y )
+{
+  return ( 1. - y ) * ( ( 1. - x ) * cell.corners[ 0 ] + x * cell.corners[ 1 ] )
+    + y * ( ( 1. - x ) * cell.corners[ 2 ] + x * cell.corners[ 3 ] );
+}
+
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -301,6 +426,18 @@ nest::siegert_neuron::calibrate()
   // propagators
   V_.P1_ = std::exp( -h / P_.tau_ );
   V_.P2_ = -numerics::expm1( -h / P_.tau_ );
+
+  // neurons keep a table with matching parameters, so that the values
+  // computed in earlier simulations are reused
+  if ( P_.interpolation_tol_ == 0. )
+  {
+    V_.siegert_table_.reset();
+  }
+  else if ( not V_.siegert_table_ or not V_.siegert_table_->matches( P_ ) )
+  {
+    V_.siegert_table_ = kernel().node_manager.get_propagator_cache().get< SiegertTable_ >(
+      get_thread(), { P_.tau_m_, P_.tau_syn_, P_.t_ref_, P_.theta_, P_.V_reset_, P_.interpolation_tol_ }, P_ );
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -27,6 +27,10 @@
 
 #ifdef HAVE_GSL
 
+// C++ includes:
+#include <memory>
+#include <unordered_map>
+
 // C includes:
 #include <gsl/gsl_integration.h>
 #include <gsl/gsl_sf_dawson.h>
@@ -89,13 +93,42 @@ The following parameters can be set in the status directory and are
 used in the evaluation of the gain function. Parameters as in
 iaf_psc_exp/delta.
 
-=========  ======  ================================================
- tau_m     ms      Membrane time constant
- tau_syn   ms      Time constant of postsynaptic currents
- t_ref     ms      Duration of refractory period
- theta     mV      Threshold relative to resting potential
- V_reset   mV      Reset relative to resting potential
-=========  ======  ================================================
+=================== ====== ================================================
+ tau_m              ms     Membrane time constant
+ tau_syn            ms     Time constant of postsynaptic currents
+ t_ref              ms     Duration of refractory period
+ theta              mV     Threshold relative to resting potential
+ V_reset            mV     Reset relative to resting potential
+ interpolation_tol  1/s    Tolerance of the interpolated gain function,
+                           0 to evaluate the gain function exactly
+                           (default)
+=================== ====== ================================================
+
+If ``interpolation_tol`` is positive, the gain function is interpolated
+bilinearly over the mean and the standard deviation of the input from a table
+that is filled on demand. The table consists of square cells with side length
+(``theta`` - ``V_reset``)/4 (in mV), halved on each of 12 levels. A cell is
+used if the interpolation at its center and at the midpoints of its edges
+deviates by at most ``interpolation_tol`` from the exact value, otherwise the
+next smaller cell is tried. Cells touching a standard deviation of zero, where
+the gain function has a kink, are never used. If no cell is accurate enough,
+the gain function is evaluated exactly. Interpolation reduces the cost of an
+update step to a few table lookups once the table covers the inputs of the
+network.
+
+The tolerance is a heuristic: it is only checked at five points of each cell,
+so the error elsewhere in a cell can be larger. A lookup computes at most one
+new cell, and the table holds at most 65536 cells of about 100 bytes each;
+inputs not covered by it are evaluated exactly.
+
+Each thread keeps its own table, shared by all neurons on the thread with the
+same parameters, so that lookups need no synchronization between threads. With
+:math:`T` threads, each cell is computed up to :math:`T` times and the tables
+take up to :math:`T` times the memory. As a lookup only refines the table by
+one cell, whether a given input is interpolated or evaluated exactly depends
+on the inputs seen before on the same thread. Rates obtained with
+interpolation may therefore differ, within the tolerance, between runs with
+different numbers of threads.
 
 References
 ++++++++++
@@ -182,6 +215,11 @@ private:
   // siegert function
   double siegert( double, double );
 
+  struct Parameters_;
+
+  //! Evaluate the siegert function for the given parameters exactly
+  static double siegert_( const Parameters_&, gsl_integration_workspace*, double, double );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< siegert_neuron >;
   friend class UniversalDataLogger< siegert_neuron >;
@@ -214,6 +252,9 @@ private:
     /** reset value in mV. */
     double V_reset_;
 
+    /** Error bound of the interpolated siegert function in 1/s, 0 for exact evaluation. */
+    double interpolation_tol_;
+
     Parameters_(); //!< Sets default parameter values
 
     void get( DictionaryDatum& ) const; //!< Store current values in dictionary
@@ -255,6 +296,86 @@ private:
 
   // ----------------------------------------------------------------
 
+  /**
+   * Siegert function interpolated from a table that is filled on demand,
+   * shared by the neurons of a thread with the same parameters.
+   *
+   * The table covers the plane of the mean mu and the standard deviation
+   * sigma of the input with square cells. Cells of level l have side length
+   * spacing_ / 2^l. A cell is accepted if bilinear interpolation from its
+   * corners is within interpolation_tol_ of the exact value at its center
+   * and at the midpoints of its edges. Cells touching sigma = 0, where the
+   * siegert function is not smooth, are never accepted. Each lookup refines
+   * the table by at most one cell, and the table is limited to max_cells_
+   * cells.
+   */
+  class SiegertTable_
+  {
+  public:
+    explicit SiegertTable_( const Parameters_& );
+    ~SiegertTable_();
+
+    SiegertTable_( const SiegertTable_& ) = delete;
+    SiegertTable_& operator=( const SiegertTable_& ) = delete;
+
+    //! Return true if the table was built for the given parameters
+    bool matches( const Parameters_& ) const;
+
+    //! Siegert function for mean mu and variance sigma_square of the input
+    double rate( const double mu, const double sigma_square ) const;
+
+  private:
+    struct Cell_
+    {
+      double corners[ 4 ]; //!< Values at (i, j), (i + 1, j), (i, j + 1), (i + 1, j + 1)
+      bool accepted;
+    };
+
+    //! Level and indices of a cell along mu and sigma
+    struct CellIndex_
+    {
+      long level;
+      long i;
+      long j;
+
+      bool
+      operator==( const CellIndex_& other ) const
+      {
+        return level == other.level and i == other.i and j == other.j;
+      }
+    };
+
+    struct CellIndexHash_
+    {
+      size_t
+      operator()( const CellIndex_& c ) const
+      {
+        return std::hash< long >()( ( c.level * 1000003 + c.i ) * 1000003 + c.j );
+      }
+    };
+
+    typedef std::unordered_map< CellIndex_, Cell_, CellIndexHash_ > CellMap_;
+
+    //! Compute the cell, which is not in the table yet, and add it
+    CellMap_::iterator insert_cell_( const CellIndex_& ) const;
+
+    static double interpolate_( const Cell_&, const double x, const double y );
+
+    //! Number of levels of cells
+    static const long num_levels_ = 12;
+
+    //! Maximal number of cells in the table, inputs outside are evaluated exactly
+    static const size_t max_cells_ = 1 << 16;
+
+    const Parameters_ P_;
+    const double spacing_; //!< Side length of cells of level 0
+
+    mutable CellMap_ cells_;
+    gsl_integration_workspace* gsl_w_;
+  };
+
+  // ----------------------------------------------------------------
+
   /**
    * Internal variables of the model.
    */
@@ -264,6 +385,9 @@ private:
     // propagators
     double P1_;
     double P2_;
+
+    //! Interpolated siegert function, null if it is evaluated exactly
+    std::shared_ptr< const SiegertTable_ > siegert_table_;
   };
 
   //! Read out the rate
@@ -26,6 +26,9 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection.h"
@@ -240,6 +243,7 @@ stdp_nn_pre_centered_synapse< targetidentifierT >::send( Event& e, thread t, con
 {
   // synapse STDP depressing/facilitation dynamics
   double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
 
   // use accessor functions (inherited from Connection< >) to obtain delay and
   // target
@@ -247,8 +251,8 @@ stdp_nn_pre_centered_synapse< targetidentifierT >::send( Event& e, thread t, con
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
@@ -274,7 +278,7 @@ stdp_nn_pre_centered_synapse< targetidentifierT >::send( Event& e, thread t, con
     // start->t_ > t_lastspike_ - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
 
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt / tau_plus_ ) );
+    weight_ = facilitate_( weight_, Kplus_ * numerics::select_exp( minus_dt / tau_plus_, fast_exp ) );
 
     // According to the presynaptic-centered nearest-neighbour scheme,
     // a postsynaptic spike
@@ -291,7 +295,7 @@ stdp_nn_pre_centered_synapse< targetidentifierT >::send( Event& e, thread t, con
   target->get_K_values( t_spike - dendritic_delay, value_to_throw_away, nearest_neighbor_Kminus, value_to_throw_away );
   weight_ = depress_( weight_, nearest_neighbor_Kminus );
 
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) / tau_plus_ ) + 1.0;
+  Kplus_ = Kplus_ * numerics::select_exp( ( t_lastspike_ - t_spike ) / tau_plus_, fast_exp ) + 1.0;
 
   e.set_receiver( *target );
   e.set_weight( weight_ );
@@ -26,6 +26,9 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection.h"
@@ -236,6 +239,7 @@ stdp_nn_symm_synapse< targetidentifierT >::send( Event& e, thread t, const Commo
 {
   // synapse STDP depressing/facilitation dynamics
   double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
 
   // use accessor functions (inherited from Connection< >) to obtain delay and
   // target
@@ -243,8 +247,8 @@ stdp_nn_symm_synapse< targetidentifierT >::send( Event& e, thread t, const Commo
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
@@ -266,7 +270,7 @@ stdp_nn_symm_synapse< targetidentifierT >::send( Event& e, thread t, const Commo
     // start->t_ > t_lastspike_ - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
 
-    weight_ = facilitate_( weight_, std::exp( minus_dt / tau_plus_ ) );
+    weight_ = facilitate_( weight_, numerics::select_exp( minus_dt / tau_plus_, fast_exp ) );
   }
 
   // depression due to the new pre-synaptic spike
@@ -26,6 +26,7 @@
 #include "common_synapse_properties.h"
 #include "connector_model.h"
 #include "event.h"
+#include "nest_time.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -42,10 +43,12 @@ STDPPLHomCommonProperties::STDPPLHomCommonProperties()
   : CommonSynapseProperties()
   , tau_plus_( 20.0 )
   , tau_plus_inv_( 1. / tau_plus_ )
+  , tau_plus_decay_table_()
   , lambda_( 0.1 )
   , alpha_( 1.0 )
   , mu_( 0.4 )
 {
+  tau_plus_decay_table_.set( tau_plus_, Time::get_resolution().get_ms() );
 }
 
 void
@@ -68,6 +71,7 @@ STDPPLHomCommonProperties::set_status( const DictionaryDatum& d, ConnectorModel&
   if ( tau_plus_ > 0. )
   {
     tau_plus_inv_ = 1. / tau_plus_;
+    tau_plus_decay_table_.set( tau_plus_, Time::get_resolution().get_ms() );
   }
   else
   {
@@ -78,4 +82,11 @@ STDPPLHomCommonProperties::set_status( const DictionaryDatum& d, ConnectorModel&
   updateValue< double >( d, names::mu, mu_ );
 }
 
+void
+STDPPLHomCommonProperties::calibrate( const TimeConverter& tc )
+{
+  CommonSynapseProperties::calibrate( tc );
+  tau_plus_decay_table_.set( tau_plus_, Time::get_resolution().get_ms() );
+}
+
 } // of namespace nest
@@ -26,6 +26,9 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "connection.h"
 
@@ -45,6 +48,10 @@ Description
 ``stdp_pl_synapse`` is a connector to create synapses with spike time
 dependent plasticity using homoegeneous parameters (as defined in [1]_).
 
+If the kernel property ``stdp_fast_exp`` is set, the decay of the presynaptic
+trace over time differences that are multiples of the resolution is taken
+from a table shared by all synapses of the model.
+
 Parameters
 ++++++++++
 
@@ -110,9 +117,15 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Tabulate the decay of Kplus for a new resolution.
+   */
+  void calibrate( const TimeConverter& );
+
   // data members common to all connections
   double tau_plus_;
-  double tau_plus_inv_; //!< 1 / tau_plus for efficiency
+  double tau_plus_inv_;                          //!< 1 / tau_plus for efficiency
+  numerics::ExpDecayTable tau_plus_decay_table_; //!< Decay of Kplus, used if stdp_fast_exp is set
   double lambda_;
   double alpha_;
   double mu_;
@@ -247,6 +260,7 @@ stdp_pl_synapse_hom< targetidentifierT >::send( Event& e, thread t, const STDPPL
   // synapse STDP depressing/facilitation dynamics
 
   const double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
 
   // t_lastspike_ = 0 initially
 
@@ -255,8 +269,8 @@ stdp_pl_synapse_hom< targetidentifierT >::send( Event& e, thread t, const STDPPL
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // facilitation due to postsynaptic spikes since last pre-synaptic spike
@@ -268,7 +282,8 @@ stdp_pl_synapse_hom< targetidentifierT >::send( Event& e, thread t, const STDPPL
     // get_history() should make sure that
     // start->t_ > t_lastspike - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt * cp.tau_plus_inv_ ), cp );
+    const double decay = fast_exp ? cp.tau_plus_decay_table_( minus_dt ) : std::exp( minus_dt * cp.tau_plus_inv_ );
+    weight_ = facilitate_( weight_, Kplus_ * decay, cp );
   }
 
   // depression due to new pre-synaptic spike
@@ -280,7 +295,8 @@ stdp_pl_synapse_hom< targetidentifierT >::send( Event& e, thread t, const STDPPL
   e.set_rport( get_rport() );
   e();
 
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) * cp.tau_plus_inv_ ) + 1.0;
+  const double dt = t_lastspike_ - t_spike;
+  Kplus_ = Kplus_ * ( fast_exp ? cp.tau_plus_decay_table_( dt ) : std::exp( dt * cp.tau_plus_inv_ ) ) + 1.0;
 
   t_lastspike_ = t_spike;
 }
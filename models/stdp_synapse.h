@@ -26,6 +26,9 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from libnestutil:
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection.h"
@@ -227,6 +230,7 @@ stdp_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSynapse
 {
   // synapse STDP depressing/facilitation dynamics
   const double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
 
   // use accessor functions (inherited from Connection< >) to obtain delay and
   // target
@@ -234,8 +238,8 @@ stdp_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSynapse
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
@@ -255,7 +259,7 @@ stdp_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSynapse
     // get_history() should make sure that
     // start->t_ > t_lastspike - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt / tau_plus_ ) );
+    weight_ = facilitate_( weight_, Kplus_ * numerics::select_exp( minus_dt / tau_plus_, fast_exp ) );
   }
 
   const double _K_value = target->get_K_value( t_spike - dendritic_delay );
@@ -269,7 +273,7 @@ stdp_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSynapse
   e.set_rport( get_rport() );
   e();
 
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) / tau_plus_ ) + 1.0;
+  Kplus_ = Kplus_ * numerics::select_exp( ( t_lastspike_ - t_spike ) / tau_plus_, fast_exp ) + 1.0;
 
   t_lastspike_ = t_spike;
 }
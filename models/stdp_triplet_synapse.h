@@ -25,6 +25,7 @@
 
 // C-header for math.h since copysign() is in C99 but not C++98
 #include "connection.h"
+#include "numerics.h"
 #include <math.h>
 
 namespace nest
@@ -249,12 +250,13 @@ stdp_triplet_synapse< targetidentifierT >::send( Event& e, thread t, const Commo
 {
 
   double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
   double dendritic_delay = get_delay();
   Node* target = get_target( t );
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // facilitation due to postsynaptic spikes since last pre-synaptic spike
@@ -272,11 +274,11 @@ stdp_triplet_synapse< targetidentifierT >::send( Event& e, thread t, const Commo
     // get_history() should make sure that
     // start->t_ > t_lastspike - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt / tau_plus_ ), ky );
+    weight_ = facilitate_( weight_, Kplus_ * numerics::select_exp( minus_dt / tau_plus_, fast_exp ), ky );
   }
 
   // depression due to new pre-synaptic spike
-  Kplus_triplet_ *= std::exp( ( t_lastspike_ - t_spike ) / tau_plus_triplet_ );
+  Kplus_triplet_ *= numerics::select_exp( ( t_lastspike_ - t_spike ) / tau_plus_triplet_, fast_exp );
 
   // dendritic delay means we must look back in time by that amount
   // for determining the K value, because the K value must propagate
@@ -284,7 +286,7 @@ stdp_triplet_synapse< targetidentifierT >::send( Event& e, thread t, const Commo
   weight_ = depress_( weight_, target->get_K_value( t_spike - dendritic_delay ), Kplus_triplet_ );
 
   Kplus_triplet_ += 1.0;
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) / tau_plus_ ) + 1.0;
+  Kplus_ = Kplus_ * numerics::select_exp( ( t_lastspike_ - t_spike ) / tau_plus_, fast_exp ) + 1.0;
 
   e.set_receiver( *target );
   e.set_weight( weight_ );
@@ -213,8 +213,8 @@ urbanczik_synapse< targetidentifierT >::send( Event& e, thread t, const CommonSy
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry_extended >::iterator start;
-  std::deque< histentry_extended >::iterator finish;
+  HistoryBuffer< histentry_extended >::iterator start;
+  HistoryBuffer< histentry_extended >::iterator finish;
 
   // for now we only support two-compartment neurons
   // in this case the dendritic compartment has index 1
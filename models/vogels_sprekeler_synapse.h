@@ -25,6 +25,7 @@
 
 // C-header for math.h since copysign() is in C99 but not C++98
 #include "connection.h"
+#include "numerics.h"
 #include <math.h>
 
 namespace nest
@@ -203,6 +204,7 @@ vogels_sprekeler_synapse< targetidentifierT >::send( Event& e, thread t, const C
 {
   // synapse STDP depressing/facilitation dynamics
   double t_spike = e.get_stamp().get_ms();
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
   // t_lastspike_ = 0 initially
 
   // use accessor functions (inherited from Connection< >) to obtain delay and
@@ -211,8 +213,8 @@ vogels_sprekeler_synapse< targetidentifierT >::send( Event& e, thread t, const C
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // presynaptic neuron j, postsynaptic neuron i
@@ -226,7 +228,7 @@ vogels_sprekeler_synapse< targetidentifierT >::send( Event& e, thread t, const C
     // get_history() should make sure that
     // start->t_ > t_lastspike - dendritic_delay, i.e. minus_dt < 0
     assert( minus_dt < -1.0 * kernel().connection_manager.get_stdp_eps() );
-    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt / tau_ ) );
+    weight_ = facilitate_( weight_, Kplus_ * numerics::select_exp( minus_dt / tau_, fast_exp ) );
   }
 
   // For pre-synaptic spikes
@@ -246,7 +248,7 @@ vogels_sprekeler_synapse< targetidentifierT >::send( Event& e, thread t, const C
   e();
 
   // exponential part for the decay, addition of one for each spike
-  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) / tau_ ) + 1.0;
+  Kplus_ = Kplus_ * numerics::select_exp( ( t_lastspike_ - t_spike ) / tau_, fast_exp ) + 1.0;
 
   t_lastspike_ = t_spike;
 }
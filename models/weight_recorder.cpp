@@ -53,12 +53,14 @@ nest::weight_recorder::weight_recorder()
 nest::weight_recorder::weight_recorder( const weight_recorder& n )
   : RecordingDevice( n )
   , P_( n.P_ )
+  , B_()
 {
 }
 
 nest::weight_recorder::Parameters_::Parameters_()
   : senders_()
   , targets_()
+  , port_stride_( 1 )
 {
 }
 
@@ -83,6 +85,7 @@ nest::weight_recorder::Parameters_::get( DictionaryDatum& d ) const
     ArrayDatum ad;
     ( *d )[ names::targets ] = ad;
   }
+  def< long >( d, names::port_stride, port_stride_ );
 }
 
 void
@@ -131,6 +134,23 @@ nest::weight_recorder::Parameters_::set( const DictionaryDatum& d )
       }
     }
   }
+
+  updateValue< long >( d, names::port_stride, port_stride_ );
+  if ( port_stride_ < 1 )
+  {
+    throw BadProperty( "port_stride must be positive." );
+  }
+}
+
+void
+nest::weight_recorder::Buffers_::clear()
+{
+  senders_.clear();
+  targets_.clear();
+  receptors_.clear();
+  ports_.clear();
+  steps_.clear();
+  weights_.clear();
 }
 
 void
@@ -143,6 +163,34 @@ nest::weight_recorder::calibrate()
 void
 nest::weight_recorder::update( Time const&, const long, const long )
 {
+  // weights are recorded during the delivery of events at the end of the
+  // previous time slice
+  write_buffered_weights_();
+}
+
+void
+nest::weight_recorder::post_run_cleanup()
+{
+  write_buffered_weights_();
+}
+
+void
+nest::weight_recorder::write_buffered_weights_()
+{
+  WeightRecorderEvent e;
+  std::vector< double > double_values( 1 );
+  std::vector< long > long_values( 3 );
+  for ( size_t i = 0; i < B_.weights_.size(); ++i )
+  {
+    e.set_stamp( Time::step( B_.steps_[ i ] ) );
+    e.set_sender_node_id( B_.senders_[ i ] );
+    double_values[ 0 ] = B_.weights_[ i ];
+    long_values[ 0 ] = static_cast< long >( B_.targets_[ i ] );
+    long_values[ 1 ] = B_.receptors_[ i ];
+    long_values[ 2 ] = B_.ports_[ i ];
+    write( e, double_values, long_values );
+  }
+  B_.clear();
 }
 
 nest::RecordingDevice::Type
@@ -190,22 +238,37 @@ nest::weight_recorder::set_status( const DictionaryDatum& d )
 
 void
 nest::weight_recorder::handle( WeightRecorderEvent& e )
+{
+  record_weight(
+    e.get_sender_node_id(), e.get_receiver_node_id(), e.get_rport(), e.get_port(), e.get_stamp(), e.get_weight() );
+}
+
+void
+nest::weight_recorder::record_weight( const index sender_node_id,
+  const index target_node_id,
+  const rport receptor,
+  const port p,
+  Time const& stamp,
+  const double weight )
 {
   // accept spikes only if recorder was active when spike was emitted
-  if ( is_active( e.get_stamp() ) )
+  if ( not is_active( stamp ) or p % P_.port_stride_ != 0 )
   {
-    // P_senders_ is defined and sender is not in it
-    // or P_targets_ is defined and receiver is not in it
-    if ( ( P_.senders_.get() and not P_.senders_->contains( e.get_sender_node_id() ) )
-      or ( P_.targets_.get() and not P_.targets_->contains( e.get_receiver_node_id() ) ) )
-    {
-      return;
-    }
+    return;
+  }
 
-    write( e,
-      { e.get_weight() },
-      { static_cast< long >( e.get_receiver_node_id() ),
-        static_cast< long >( e.get_rport() ),
-        static_cast< long >( e.get_port() ) } );
+  // P_senders_ is defined and sender is not in it
+  // or P_targets_ is defined and receiver is not in it
+  if ( ( P_.senders_.get() and not P_.senders_->contains( sender_node_id ) )
+    or ( P_.targets_.get() and not P_.targets_->contains( target_node_id ) ) )
+  {
+    return;
   }
+
+  B_.senders_.push_back( sender_node_id );
+  B_.targets_.push_back( target_node_id );
+  B_.receptors_.push_back( receptor );
+  B_.ports_.push_back( p );
+  B_.steps_.push_back( stamp.get_steps() );
+  B_.weights_.push_back( weight );
 }
@@ -59,7 +59,13 @@ synapses.
 To only record from a subset of connected synapses, the
 weight recorder accepts NodeCollections in the parameters ``senders`` and
 ``targets``. If set, they restrict the recording of data to only
-synapses that fulfill the given criteria.
+synapses that fulfill the given criteria. Setting ``port_stride`` to n
+records only every n-th synapse, namely those whose port, the index of the
+synapse among the synapses of its model on its thread, is a multiple of n.
+
+The weights are collected in a buffer on each thread and handed to the
+recording backend once per time slice and at the end of each call to
+``Run``.
 
 ::
 
@@ -117,6 +123,13 @@ public:
 
   void handle( WeightRecorderEvent& );
 
+  void record_weight( const index sender_node_id,
+    const index target_node_id,
+    const rport receptor,
+    const port p,
+    Time const& stamp,
+    const double weight );
+
   port handles_test_event( WeightRecorderEvent&, rport );
 
   Type get_type() const;
@@ -125,14 +138,20 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void post_run_cleanup();
+
 private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  //! Hand the buffered weights to the recording backend
+  void write_buffered_weights_();
+
   struct Parameters_
   {
     NodeCollectionDatum senders_;
     NodeCollectionDatum targets_;
+    long port_stride_; //!< Record only synapses whose port is a multiple of this
 
     Parameters_();
     Parameters_( const Parameters_& ) = default;
@@ -140,7 +159,24 @@ private:
     void set( const DictionaryDatum& );
   };
 
+  /**
+   * Weights recorded since the last write to the backend, one column per
+   * quantity.
+   */
+  struct Buffers_
+  {
+    std::vector< index > senders_;
+    std::vector< index > targets_;
+    std::vector< long > receptors_;
+    std::vector< long > ports_;
+    std::vector< long > steps_; //!< Time stamps in steps
+    std::vector< double > weights_;
+
+    void clear();
+  };
+
   Parameters_ P_;
+  Buffers_ B_;
 };
 
 inline port
@@ -0,0 +1,99 @@
+/*
+ *  alias_table.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "alias_table.h"
+
+// C++ includes:
+#include <cassert>
+#include <numeric>
+
+namespace nest
+{
+
+AliasTable::AliasTable()
+  : prob_()
+  , alias_()
+{
+}
+
+AliasTable::AliasTable( const std::vector< double >& weights )
+  : prob_()
+  , alias_()
+{
+  build( weights );
+}
+
+void
+AliasTable::build( const std::vector< double >& weights )
+{
+  const size_t n = weights.size();
+  const double sum = std::accumulate( weights.begin(), weights.end(), 0.0 );
+  assert( n > 0 and sum > 0.0 );
+
+  prob_.resize( n );
+  alias_.resize( n );
+
+  // Scale weights to mean one and sort them into entries below and above the mean.
+  std::vector< index > small;
+  std::vector< index > large;
+  for ( index i = 0; i < n; ++i )
+  {
+    prob_[ i ] = weights[ i ] * n / sum;
+    alias_[ i ] = i;
+    if ( prob_[ i ] < 1.0 )
+    {
+      small.push_back( i );
+    }
+    else
+    {
+      large.push_back( i );
+    }
+  }
+
+  // Fill up each small entry with the excess of a large one.
+  while ( not small.empty() and not large.empty() )
+  {
+    const index s = small.back();
+    small.pop_back();
+    const index l = large.back();
+
+    alias_[ s ] = l;
+    prob_[ l ] -= 1.0 - prob_[ s ];
+    if ( prob_[ l ] < 1.0 )
+    {
+      large.pop_back();
+      small.push_back( l );
+    }
+  }
+
+  // Entries left over differ from one by rounding errors only.
+  for ( const index i : large )
+  {
+    prob_[ i ] = 1.0;
+  }
+  for ( const index i : small )
+  {
+    prob_[ i ] = 1.0;
+  }
+}
+
+} // namespace nest
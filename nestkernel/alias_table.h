@@ -0,0 +1,90 @@
+/*
+ *  alias_table.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+#include "random_generators.h"
+
+namespace nest
+{
+
+/**
+ * Walker alias table for drawing indices with given relative weights.
+ *
+ * Building the table takes time linear in the number of weights, after
+ * which each draw takes constant time, using one uniform integer and one
+ * uniform double. A std::discrete_distribution, in contrast, needs
+ * logarithmic time per draw. The table is built with Vose's method.
+ */
+class AliasTable
+{
+public:
+  AliasTable();
+
+  /**
+   * Create table for the given weights, see build().
+   */
+  explicit AliasTable( const std::vector< double >& weights );
+
+  /**
+   * Build table for the given weights. Weights must be non-negative and
+   * their sum must be positive.
+   */
+  void build( const std::vector< double >& weights );
+
+  /**
+   * Draw an index i with probability weights[i] / sum( weights ).
+   */
+  index operator()( RngPtr rng ) const;
+
+  /**
+   * @returns number of weights in the table.
+   */
+  size_t size() const;
+
+private:
+  std::vector< double > prob_; //!< probability of keeping the first draw
+  std::vector< index > alias_; //!< index drawn otherwise
+};
+
+inline index
+AliasTable::operator()( RngPtr rng ) const
+{
+  const index i = rng->ulrand( prob_.size() );
+  return rng->drand() < prob_[ i ] ? i : alias_[ i ];
+}
+
+inline size_t
+AliasTable::size() const
+{
+  return prob_.size();
+}
+
+} // namespace nest
+
+#endif /* ALIAS_TABLE_H */
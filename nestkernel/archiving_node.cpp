@@ -22,6 +22,14 @@
 
 #include "archiving_node.h"
 
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Includes from libnestutil:
+#include "numerics.h"
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 
@@ -44,6 +52,9 @@ nest::ArchivingNode::ArchivingNode()
   , max_delay_( 0 )
   , trace_( 0.0 )
   , last_spike_( -1.0 )
+  , K_table_slice_origin_( -1 )
+  , K_table_first_step_( 0 )
+  , K_table_()
 {
 }
 
@@ -59,20 +70,26 @@ nest::ArchivingNode::ArchivingNode( const ArchivingNode& n )
   , max_delay_( n.max_delay_ )
   , trace_( n.trace_ )
   , last_spike_( n.last_spike_ )
+  , K_table_slice_origin_( -1 )
+  , K_table_first_step_( 0 )
+  , K_table_()
 {
 }
 
 void
 ArchivingNode::register_stdp_connection( double t_first_read, double delay )
 {
-  // Mark all entries in the deque, which we will not read in future as read by
-  // this input input, so that we savely increment the incoming number of
+  // Mark all entries in the history, which we will not read in future as read
+  // by this input input, so that we savely increment the incoming number of
   // connections afterwards without leaving spikes in the history.
   // For details see bug #218. MH 08-04-22
 
-  for ( std::deque< histentry >::iterator runner = history_.begin();
-        runner != history_.end() and ( t_first_read - runner->t_ > -1.0 * kernel().connection_manager.get_stdp_eps() );
-        ++runner )
+  const double eps = kernel().connection_manager.get_stdp_eps();
+  const HistoryBuffer< histentry >::iterator first_unread =
+    std::partition_point( history_.begin(),
+      history_.end(),
+      [ t_first_read, eps ]( const histentry& h ) { return t_first_read - h.t_ > -eps; } );
+  for ( HistoryBuffer< histentry >::iterator runner = history_.begin(); runner != first_unread; ++runner )
   {
     ( runner->access_counter_ )++;
   }
@@ -82,35 +99,91 @@ ArchivingNode::register_stdp_connection( double t_first_read, double delay )
   max_delay_ = std::max( delay, max_delay_ );
 }
 
+HistoryBuffer< histentry >::iterator
+nest::ArchivingNode::last_entry_before_( double t )
+{
+  // The history is ordered by spike time, so the entries strictly more than
+  // eps before t form a prefix of it.
+  const double eps = kernel().connection_manager.get_stdp_eps();
+  const HistoryBuffer< histentry >::iterator first_not_before = std::partition_point(
+    history_.begin(), history_.end(), [ t, eps ]( const histentry& h ) { return t - h.t_ > eps; } );
+  return first_not_before == history_.begin() ? history_.end() : first_not_before - 1;
+}
+
+double
+nest::ArchivingNode::compute_K_value_( double t, const bool fast_exp )
+{
+  // search for the latest post spike in the history buffer that came strictly
+  // before `t`
+  const HistoryBuffer< histentry >::iterator entry = last_entry_before_( t );
+
+  // this case occurs when the neuron has not yet spiked or the trace was
+  // requested at a time precisely at or before the first spike in the history
+  if ( entry == history_.end() )
+  {
+    return 0.;
+  }
+
+  return entry->Kminus_ * numerics::select_exp( ( entry->t_ - t ) * tau_minus_inv_, fast_exp );
+}
+
 double
 nest::ArchivingNode::get_K_value( double t )
 {
-  // case when the neuron has not yet spiked
-  if ( history_.empty() )
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
+  if ( not kernel().connection_manager.use_stdp_trace_cache() )
   {
-    trace_ = 0.;
+    trace_ = compute_K_value_( t, fast_exp );
     return trace_;
   }
 
-  // search for the latest post spike in the history buffer that came strictly
-  // before `t`
-  int i = history_.size() - 1;
-  while ( i >= 0 )
+  // The spikes delivered in a slice were sent in the previous min_delay
+  // steps, so the synapses request the trace at most min_delay + max_delay
+  // steps before the origin of the slice.
+  const long slice_origin = kernel().simulation_manager.get_slice_origin().get_steps();
+  if ( slice_origin != K_table_slice_origin_ )
   {
-    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
-    {
-      trace_ = ( history_[ i ].Kminus_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
-      return trace_;
-    }
-    --i;
+    const long min_delay = kernel().connection_manager.get_min_delay();
+    const long max_delay = kernel().connection_manager.get_max_delay();
+    K_table_slice_origin_ = slice_origin;
+    K_table_first_step_ = slice_origin - min_delay - max_delay;
+    K_table_.resize( min_delay + max_delay );
+    clear_K_table_();
   }
 
-  // this case occurs when the trace was requested at a time precisely at or
-  // before the first spike in the history
-  trace_ = 0.;
+  // Only times on the grid within stdp_eps share a table entry, the others
+  // are computed directly.
+  const double h = Time::get_resolution().get_ms();
+  const double steps = std::round( t / h );
+  const long i = static_cast< long >( steps ) - K_table_first_step_;
+  if ( std::abs( t - steps * h ) > kernel().connection_manager.get_stdp_eps() or i < 0
+    or i >= static_cast< long >( K_table_.size() ) )
+  {
+    trace_ = compute_K_value_( t, fast_exp );
+    return trace_;
+  }
+
+  // All synapses with the same delay that receive spikes with the same time
+  // stamp request the trace at the same t. The entry is only reused for
+  // exactly the same t, so that the values are identical to those computed
+  // without the table.
+  std::pair< double, double >& entry = K_table_[ i ];
+  if ( entry.first != t )
+  {
+    entry.first = t;
+    entry.second = compute_K_value_( t, fast_exp );
+  }
+  trace_ = entry.second;
   return trace_;
 }
 
+void
+nest::ArchivingNode::clear_K_table_()
+{
+  std::fill(
+    K_table_.begin(), K_table_.end(), std::make_pair( std::numeric_limits< double >::quiet_NaN(), 0.0 ) );
+}
+
 void
 nest::ArchivingNode::get_K_values( double t,
   double& K_value,
@@ -128,59 +201,49 @@ nest::ArchivingNode::get_K_values( double t,
 
   // search for the latest post spike in the history buffer that came strictly
   // before `t`
-  int i = history_.size() - 1;
-  while ( i >= 0 )
-  {
-    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
-    {
-      K_triplet_value =
-        ( history_[ i ].Kminus_triplet_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_triplet_inv_ ) );
-      K_value = ( history_[ i ].Kminus_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
-      nearest_neighbor_K_value = std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ );
-      return;
-    }
-    --i;
-  }
+  const HistoryBuffer< histentry >::iterator entry = last_entry_before_( t );
 
   // this case occurs when the trace was requested at a time precisely at or
   // before the first spike in the history
-  K_triplet_value = 0.0;
-  nearest_neighbor_K_value = 0.0;
-  K_value = 0.0;
+  if ( entry == history_.end() )
+  {
+    K_triplet_value = 0.0;
+    nearest_neighbor_K_value = 0.0;
+    K_value = 0.0;
+    return;
+  }
+
+  const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
+  const double decay = numerics::select_exp( ( entry->t_ - t ) * tau_minus_inv_, fast_exp );
+  K_triplet_value = entry->Kminus_triplet_
+    * numerics::select_exp( ( entry->t_ - t ) * tau_minus_triplet_inv_, fast_exp );
+  K_value = entry->Kminus_ * decay;
+  nearest_neighbor_K_value = decay;
 }
 
 void
 nest::ArchivingNode::get_history( double t1,
   double t2,
-  std::deque< histentry >::iterator* start,
-  std::deque< histentry >::iterator* finish )
+  HistoryBuffer< histentry >::iterator* start,
+  HistoryBuffer< histentry >::iterator* finish )
 {
-  *finish = history_.end();
-  if ( history_.empty() )
-  {
-    *start = *finish;
-    return;
-  }
-  std::deque< histentry >::reverse_iterator runner = history_.rbegin();
   const double t2_lim = t2 + kernel().connection_manager.get_stdp_eps();
   const double t1_lim = t1 + kernel().connection_manager.get_stdp_eps();
-  while ( runner != history_.rend() and runner->t_ >= t2_lim )
-  {
-    ++runner;
-  }
-  *finish = runner.base();
-  while ( runner != history_.rend() and runner->t_ >= t1_lim )
+  *finish = std::partition_point(
+    history_.begin(), history_.end(), [ t2_lim ]( const histentry& h ) { return h.t_ < t2_lim; } );
+  *start =
+    std::partition_point( history_.begin(), *finish, [ t1_lim ]( const histentry& h ) { return h.t_ < t1_lim; } );
+  for ( HistoryBuffer< histentry >::iterator runner = *start; runner != *finish; ++runner )
   {
     runner->access_counter_++;
-    ++runner;
   }
-  *start = runner.base();
 }
 
 void
 nest::ArchivingNode::set_spiketime( Time const& t_sp, double offset )
 {
   StructuralPlasticityNode::set_spiketime( t_sp, offset );
+  clear_K_table_();
 
   const double t_sp_ms = t_sp.get_ms() - offset;
 
@@ -206,8 +269,10 @@ nest::ArchivingNode::set_spiketime( Time const& t_sp, double offset )
       }
     }
     // update spiking history
-    Kminus_ = Kminus_ * std::exp( ( last_spike_ - t_sp_ms ) * tau_minus_inv_ ) + 1.0;
-    Kminus_triplet_ = Kminus_triplet_ * std::exp( ( last_spike_ - t_sp_ms ) * tau_minus_triplet_inv_ ) + 1.0;
+    const bool fast_exp = kernel().connection_manager.use_stdp_fast_exp();
+    Kminus_ = Kminus_ * numerics::select_exp( ( last_spike_ - t_sp_ms ) * tau_minus_inv_, fast_exp ) + 1.0;
+    Kminus_triplet_ =
+      Kminus_triplet_ * numerics::select_exp( ( last_spike_ - t_sp_ms ) * tau_minus_triplet_inv_, fast_exp ) + 1.0;
     last_spike_ = t_sp_ms;
     history_.push_back( histentry( last_spike_, Kminus_, Kminus_triplet_, 0 ) );
   }
@@ -253,6 +318,7 @@ nest::ArchivingNode::set_status( const DictionaryDatum& d )
   tau_minus_triplet_ = new_tau_minus_triplet;
   tau_minus_inv_ = 1. / tau_minus_;
   tau_minus_triplet_inv_ = 1. / tau_minus_triplet_;
+  clear_K_table_();
 
   // check, if to clear spike history and K_minus
   bool clear = false;
@@ -270,6 +336,7 @@ nest::ArchivingNode::clear_history()
   Kminus_ = 0.0;
   Kminus_triplet_ = 0.0;
   history_.clear();
+  clear_K_table_();
 }
 
 
@@ -25,10 +25,12 @@
 
 // C++ includes:
 #include <algorithm>
-#include <deque>
+#include <utility>
+#include <vector>
 
 // Includes from nestkernel:
 #include "histentry.h"
+#include "history_buffer.h"
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node.h"
@@ -66,6 +68,11 @@ public:
    * return the Kminus (synaptic trace) value at t (in ms). When the trace is
    * requested at the exact same time that the neuron emits a spike, the trace
    * value as it was just before the spike is returned.
+   *
+   * If the kernel property stdp_trace_cache is set, the values at times on
+   * the grid are kept in a table for the current slice, so that synapses
+   * receiving spikes with the same time stamp and delay only compute the
+   * value once.
    */
   double get_K_value( double t );
 
@@ -100,22 +107,22 @@ public:
   }
 
   /**
-   * \fn double get_K_triplet_value(std::deque<histentry>::iterator &iter)
+   * \fn double get_K_triplet_value(HistoryBuffer<histentry>::iterator &iter)
    * return the triplet Kminus value for the associated iterator.
    */
-  double get_K_triplet_value( const std::deque< histentry >::iterator& iter );
+  double get_K_triplet_value( const HistoryBuffer< histentry >::iterator& iter );
 
   /**
    * \fn void get_history(long t1, long t2,
-   * std::deque<Archiver::histentry>::iterator* start,
-   * std::deque<Archiver::histentry>::iterator* finish)
+   * HistoryBuffer<histentry>::iterator* start,
+   * HistoryBuffer<histentry>::iterator* finish)
    * return the spike times (in steps) of spikes which occurred in the range
-   * (t1,t2].
+   * (t1,t2]. The range is found by binary search on the spike times.
    */
   void get_history( double t1,
     double t2,
-    std::deque< histentry >::iterator* start,
-    std::deque< histentry >::iterator* finish );
+    HistoryBuffer< histentry >::iterator* start,
+    HistoryBuffer< histentry >::iterator* finish );
 
   /**
    * Register a new incoming STDP connection.
@@ -125,10 +132,31 @@ public:
    */
   void register_stdp_connection( double t_first_read, double delay );
 
+  /**
+   * Return the number of registered STDP connections.
+   */
+  size_t
+  get_num_stdp_connections() const
+  {
+    return n_incoming_;
+  }
+
+  /**
+   * Return the maximal delay of the registered STDP connections.
+   */
+  double
+  get_max_stdp_delay() const
+  {
+    return max_delay_;
+  }
+
   void get_status( DictionaryDatum& d ) const;
   void set_status( const DictionaryDatum& d );
 
 protected:
+  //! NodeBatch records spikes for the nodes it updates
+  friend class NodeBatch;
+
   /**
    * \fn void set_spiketime(Time const & t_sp, double offset)
    * record spike history
@@ -171,8 +199,31 @@ private:
 
   double last_spike_;
 
-  // spiking history needed by stdp synapses
-  std::deque< histentry > history_;
+  //! Return the last entry of the history strictly more than eps before t, or history_.end()
+  HistoryBuffer< histentry >::iterator last_entry_before_( double t );
+
+  //! Compute the Kminus value at t from the history, using numerics::fast_exp() if fast_exp is set
+  double compute_K_value_( double t, const bool fast_exp );
+
+  //! Invalidate all entries of K_table_
+  void clear_K_table_();
+
+  //! Origin in steps of the slice K_table_ was filled in, -1 if none
+  long K_table_slice_origin_;
+
+  //! Step of the first entry of K_table_
+  long K_table_first_step_;
+
+  /**
+   * Times and values returned by get_K_value() in the current slice since
+   * the history last changed, indexed by the time in steps relative to
+   * K_table_first_step_. Only used if the kernel property stdp_trace_cache
+   * is set. Invalid entries have NaN as time.
+   */
+  std::vector< std::pair< double, double > > K_table_;
+
+  // spiking history needed by stdp synapses, ordered by spike time
+  HistoryBuffer< histentry > history_;
 };
 
 inline double
@@ -0,0 +1,175 @@
+/*
+ *  cell_list.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CELL_LIST_H
+#define CELL_LIST_H
+
+// C++ includes:
+#include <bitset>
+#include <utility>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+// Includes from spatial:
+#include "position.h"
+
+namespace nest
+{
+
+template < int D >
+class Mask;
+
+/**
+ * A CellList divides the region covered by a layer into a uniform grid of
+ * cells and stores the nodes sorted by cell. The coordinates of the nodes
+ * are kept in one contiguous array per dimension, so that testing the nodes
+ * of a cell against a ball or box mask is a simple loop over contiguous
+ * memory which the compiler can vectorize.
+ *
+ * For layers with roughly uniform density and masks which are small
+ * compared to the layer, a cell list with cells sized to the mask is
+ * considerably faster to query than an Ntree, as only the few cells
+ * overlapping the bounding box of the mask need to be visited.
+ */
+template < int D, class T >
+class CellList
+{
+public:
+  typedef std::pair< Position< D >, T > value_type;
+
+  /**
+   * Create a cell list covering the given region. In each dimension, the
+   * region is divided into as many cells of at least the given size as
+   * fit into the extent of the region.
+   * @param lower_left Lower left corner of the region.
+   * @param extent     Size of the region.
+   * @param periodic   Periodic boundary conditions.
+   * @param cell_size  Minimal size of the cells.
+   */
+  CellList( const Position< D >& lower_left,
+    const Position< D >& extent,
+    std::bitset< D > periodic,
+    const Position< D >& cell_size );
+
+  /**
+   * Sort the given nodes into the cells. Positions are mapped into the
+   * region for periodic dimensions, as for Ntree::insert(). The relative
+   * order of nodes within each cell is kept.
+   */
+  void insert( const std::vector< value_type >& nodes );
+
+  /**
+   * Append all nodes inside the mask centered on the anchor to the result.
+   * @param mask    mask to apply.
+   * @param anchor  position to center mask in.
+   * @param result  vector to which the nodes inside the mask are appended.
+   */
+  void get_nodes( const Mask< D >& mask, const Position< D >& anchor, std::vector< value_type >& result ) const;
+
+  /**
+   * @returns number of nodes in the cell list.
+   */
+  size_t
+  size() const
+  {
+    return items_.size();
+  }
+
+  /**
+   * Size of the cells for queries with the given mask. Cells are sized to
+   * the bounding box of the mask, but not so small that there are more cells
+   * than nodes.
+   */
+  static Position< D > cell_size_for( const Mask< D >& mask, const Position< D >& extent, size_t num_nodes );
+
+private:
+  /**
+   * Masks for which the test of individual nodes is inlined.
+   */
+  enum ShapeType
+  {
+    GENERIC,
+    BALL,
+    BOX
+  };
+
+  /**
+   * Geometry of a mask for the inlined node test. If converse is set, the
+   * mask is the ConverseMask of a ball or box.
+   */
+  struct Shape
+  {
+    ShapeType type;
+    bool converse;
+    Position< D > center;
+    double radius;
+    Position< D > lower_left;
+    Position< D > upper_right;
+  };
+
+  static Shape get_shape_( const Mask< D >& mask );
+
+  /**
+   * Compute the images of the anchor needed to cover the mask with periodic
+   * boundary conditions, in the same way as Ntree::masked_iterator.
+   */
+  void get_anchors_( const Mask< D >& mask, const Position< D >& anchor, std::vector< Position< D > >& anchors ) const;
+
+  /**
+   * @returns index of the cell containing coordinate x in dimension dim,
+   * clamped to the valid range.
+   */
+  index cell_index_( int dim, double x ) const;
+
+  /**
+   * Test the nodes begin to end against the mask and append those inside.
+   */
+  void append_inside_( const Shape& shape,
+    const Mask< D >& mask,
+    const Position< D >& anchor,
+    index begin,
+    index end,
+    std::vector< value_type >& result ) const;
+
+  void append_all_( index begin, index end, std::vector< value_type >& result ) const;
+
+  Position< D > lower_left_;
+  Position< D > extent_;
+  std::bitset< D > periodic_;
+  Position< D > cell_size_;
+  Position< D, index > num_cells_;
+  Position< D, index > stride_;
+
+  //! cell c contains nodes cell_begin_[c] to cell_begin_[c+1]
+  std::vector< index > cell_begin_;
+
+  //! one array of coordinates per dimension, sorted by cell
+  std::vector< double > coords_[ D ];
+
+  std::vector< T > items_;
+};
+
+} // namespace nest
+
+#endif
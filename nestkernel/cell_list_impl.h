@@ -0,0 +1,426 @@
+/*
+ *  cell_list_impl.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CELL_LIST_IMPL_H
+#define CELL_LIST_IMPL_H
+
+#include "cell_list.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+
+// Includes from spatial:
+#include "mask.h"
+
+namespace nest
+{
+
+template < int D, class T >
+CellList< D, T >::CellList( const Position< D >& lower_left,
+  const Position< D >& extent,
+  std::bitset< D > periodic,
+  const Position< D >& cell_size )
+  : lower_left_( lower_left )
+  , extent_( extent )
+  , periodic_( periodic )
+{
+  index num_cells = 1;
+  for ( int i = 0; i < D; ++i )
+  {
+    num_cells_[ i ] = 1;
+    if ( cell_size[ i ] > 0 and cell_size[ i ] < extent_[ i ] )
+    {
+      num_cells_[ i ] = static_cast< index >( extent_[ i ] / cell_size[ i ] );
+    }
+    cell_size_[ i ] = extent_[ i ] / num_cells_[ i ];
+    stride_[ i ] = num_cells;
+    num_cells *= num_cells_[ i ];
+  }
+  cell_begin_.resize( num_cells + 1, 0 );
+}
+
+template < int D, class T >
+index
+CellList< D, T >::cell_index_( int dim, double x ) const
+{
+  const double i = std::floor( ( x - lower_left_[ dim ] ) / cell_size_[ dim ] );
+  if ( i < 0 )
+  {
+    return 0;
+  }
+  if ( i >= num_cells_[ dim ] )
+  {
+    return num_cells_[ dim ] - 1;
+  }
+  return static_cast< index >( i );
+}
+
+template < int D, class T >
+void
+CellList< D, T >::insert( const std::vector< value_type >& nodes )
+{
+  assert( items_.empty() );
+
+  const size_t num_nodes = nodes.size();
+  std::vector< index > cell_of_node( num_nodes );
+  std::vector< Position< D > > positions( num_nodes );
+
+  for ( size_t n = 0; n < num_nodes; ++n )
+  {
+    Position< D > pos = nodes[ n ].first;
+    index cell = 0;
+    for ( int i = 0; i < D; ++i )
+    {
+      // Map position into standard range when using periodic b.c.
+      if ( periodic_[ i ] )
+      {
+        pos[ i ] = lower_left_[ i ] + std::fmod( pos[ i ] - lower_left_[ i ], extent_[ i ] );
+        if ( pos[ i ] < lower_left_[ i ] )
+        {
+          pos[ i ] += extent_[ i ];
+        }
+      }
+      cell += stride_[ i ] * cell_index_( i, pos[ i ] );
+    }
+    positions[ n ] = pos;
+    cell_of_node[ n ] = cell;
+    ++cell_begin_[ cell + 1 ];
+  }
+
+  for ( size_t c = 1; c < cell_begin_.size(); ++c )
+  {
+    cell_begin_[ c ] += cell_begin_[ c - 1 ];
+  }
+
+  for ( int i = 0; i < D; ++i )
+  {
+    coords_[ i ].resize( num_nodes );
+  }
+  items_.resize( num_nodes );
+
+  // Counting sort; stable, so nodes keep their relative order within cells.
+  std::vector< index > next( cell_begin_.begin(), cell_begin_.end() - 1 );
+  for ( size_t n = 0; n < num_nodes; ++n )
+  {
+    const index k = next[ cell_of_node[ n ] ]++;
+    for ( int i = 0; i < D; ++i )
+    {
+      coords_[ i ][ k ] = positions[ n ][ i ];
+    }
+    items_[ k ] = nodes[ n ].second;
+  }
+}
+
+template < int D, class T >
+typename CellList< D, T >::Shape
+CellList< D, T >::get_shape_( const Mask< D >& mask )
+{
+  Shape shape;
+  shape.type = GENERIC;
+  shape.converse = false;
+  shape.radius = 0;
+
+  const Mask< D >* m = &mask;
+  const ConverseMask< D >* converse = dynamic_cast< const ConverseMask< D >* >( m );
+  if ( converse )
+  {
+    shape.converse = true;
+    m = &converse->get_mask();
+  }
+
+  const BallMask< D >* ball = dynamic_cast< const BallMask< D >* >( m );
+  if ( ball )
+  {
+    shape.type = BALL;
+    shape.center = ball->get_center();
+    shape.radius = ball->get_radius();
+    return shape;
+  }
+
+  const BoxMask< D >* box = dynamic_cast< const BoxMask< D >* >( m );
+  if ( box and not box->is_rotated() )
+  {
+    shape.type = BOX;
+    shape.lower_left = box->get_lower_left();
+    shape.upper_right = box->get_upper_right();
+  }
+
+  return shape;
+}
+
+template < int D, class T >
+Position< D >
+CellList< D, T >::cell_size_for( const Mask< D >& mask, const Position< D >& extent, size_t num_nodes )
+{
+  const Box< D > bb = mask.get_bbox();
+  Position< D > cell_size = bb.upper_right - bb.lower_left;
+
+  // Avoid more cells than nodes; empty cells only cost time.
+  double num_cells = 1.0;
+  for ( int i = 0; i < D; ++i )
+  {
+    num_cells *= std::max( 1.0, std::floor( extent[ i ] / cell_size[ i ] ) );
+  }
+  if ( num_cells > num_nodes )
+  {
+    cell_size = cell_size * std::pow( num_cells / std::max( num_nodes, size_t( 1 ) ), 1.0 / D );
+  }
+  return cell_size;
+}
+
+// Proper mod which returns non-negative numbers
+static inline double
+cell_list_mod( double x, double p )
+{
+  x = std::fmod( x, p );
+  if ( x < 0 )
+  {
+    x += p;
+  }
+  return x;
+}
+
+template < int D, class T >
+void
+CellList< D, T >::get_anchors_( const Mask< D >& mask,
+  const Position< D >& anchor,
+  std::vector< Position< D > >& anchors ) const
+{
+  anchors.clear();
+  if ( periodic_.none() )
+  {
+    anchors.push_back( anchor );
+    return;
+  }
+
+  const Box< D > mask_bb = mask.get_bbox();
+  Position< D > main_anchor = anchor;
+
+  // Move lower left corner of mask into main image of layer
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] )
+    {
+      main_anchor[ i ] = cell_list_mod( main_anchor[ i ] + mask_bb.lower_left[ i ] - lower_left_[ i ], extent_[ i ] )
+        - mask_bb.lower_left[ i ] + lower_left_[ i ];
+    }
+  }
+  anchors.push_back( main_anchor );
+
+  // Add extra anchors for each dimension where this is needed
+  // (Assumes that the mask is not wider than the layer)
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] )
+    {
+      const size_t n = anchors.size();
+      if ( ( main_anchor[ i ] + mask_bb.upper_right[ i ] - lower_left_[ i ] ) > extent_[ i ] )
+      {
+        for ( size_t j = 0; j < n; ++j )
+        {
+          Position< D > p = anchors[ j ];
+          p[ i ] -= extent_[ i ];
+          anchors.push_back( p );
+        }
+      }
+    }
+  }
+}
+
+template < int D, class T >
+void
+CellList< D, T >::append_all_( index begin, index end, std::vector< value_type >& result ) const
+{
+  Position< D > pos;
+  for ( index k = begin; k < end; ++k )
+  {
+    for ( int i = 0; i < D; ++i )
+    {
+      pos[ i ] = coords_[ i ][ k ];
+    }
+    result.push_back( value_type( pos, items_[ k ] ) );
+  }
+}
+
+template < int D, class T >
+void
+CellList< D, T >::append_inside_( const Shape& shape,
+  const Mask< D >& mask,
+  const Position< D >& anchor,
+  index begin,
+  index end,
+  std::vector< value_type >& result ) const
+{
+  // Nodes are tested in blocks. The tests for balls and boxes below compute
+  // exactly the same expressions as BallMask::inside() and BoxMask::inside(),
+  // but without branches, so that the loops over nodes are vectorized.
+  const index block_size = 64;
+  bool is_inside[ block_size ];
+
+  const double sign = shape.converse ? -1.0 : 1.0;
+
+  for ( index block_begin = begin; block_begin < end; block_begin += block_size )
+  {
+    const index n = std::min( block_size, end - block_begin );
+
+    switch ( shape.type )
+    {
+    case BALL:
+    {
+      const double r = shape.radius;
+      for ( index j = 0; j < n; ++j )
+      {
+        double max_d = 0.0;
+        double sum_d = 0.0;
+        double sum_sq = 0.0;
+        for ( int i = 0; i < D; ++i )
+        {
+          const double d = sign * ( coords_[ i ][ block_begin + j ] - anchor[ i ] ) - shape.center[ i ];
+          max_d = std::max( max_d, std::abs( d ) );
+          sum_d += std::abs( d );
+          sum_sq += d * d;
+        }
+        is_inside[ j ] = ( max_d <= r ) & ( ( sum_d <= r ) | ( std::sqrt( sum_sq ) <= r ) );
+      }
+      break;
+    }
+    case BOX:
+    {
+      for ( index j = 0; j < n; ++j )
+      {
+        bool in = true;
+        for ( int i = 0; i < D; ++i )
+        {
+          const double p = sign * ( coords_[ i ][ block_begin + j ] - anchor[ i ] );
+          in &= ( shape.lower_left[ i ] <= p ) & ( p <= shape.upper_right[ i ] );
+        }
+        is_inside[ j ] = in;
+      }
+      break;
+    }
+    default:
+    {
+      Position< D > pos;
+      for ( index j = 0; j < n; ++j )
+      {
+        for ( int i = 0; i < D; ++i )
+        {
+          pos[ i ] = coords_[ i ][ block_begin + j ] - anchor[ i ];
+        }
+        is_inside[ j ] = mask.inside( pos );
+      }
+      break;
+    }
+    }
+
+    Position< D > pos;
+    for ( index j = 0; j < n; ++j )
+    {
+      if ( is_inside[ j ] )
+      {
+        for ( int i = 0; i < D; ++i )
+        {
+          pos[ i ] = coords_[ i ][ block_begin + j ];
+        }
+        result.push_back( value_type( pos, items_[ block_begin + j ] ) );
+      }
+    }
+  }
+}
+
+template < int D, class T >
+void
+CellList< D, T >::get_nodes( const Mask< D >& mask,
+  const Position< D >& anchor,
+  std::vector< value_type >& result ) const
+{
+  const Shape shape = get_shape_( mask );
+  const Box< D > mask_bb = mask.get_bbox();
+
+  std::vector< Position< D > > anchors;
+  get_anchors_( mask, anchor, anchors );
+
+  for ( const auto& a : anchors )
+  {
+    // Range of cells overlapping the bounding box of the mask
+    Position< D, index > first;
+    Position< D, index > last;
+    bool empty = false;
+    for ( int i = 0; i < D; ++i )
+    {
+      const double lower = a[ i ] + mask_bb.lower_left[ i ];
+      const double upper = a[ i ] + mask_bb.upper_right[ i ];
+      empty |= upper < lower_left_[ i ] or lower > lower_left_[ i ] + extent_[ i ];
+      first[ i ] = cell_index_( i, lower );
+      last[ i ] = cell_index_( i, upper );
+    }
+    if ( empty )
+    {
+      continue;
+    }
+
+    Position< D, index > cell = first;
+    while ( true )
+    {
+      index c = 0;
+      Position< D > cell_lower_left;
+      for ( int i = 0; i < D; ++i )
+      {
+        c += stride_[ i ] * cell[ i ];
+        cell_lower_left[ i ] = lower_left_[ i ] + cell[ i ] * cell_size_[ i ] - a[ i ];
+      }
+
+      const index begin = cell_begin_[ c ];
+      const index end = cell_begin_[ c + 1 ];
+      if ( begin < end )
+      {
+        const Box< D > cell_box( cell_lower_left, cell_lower_left + cell_size_ );
+        if ( mask.inside( cell_box ) )
+        {
+          append_all_( begin, end, result );
+        }
+        else if ( not mask.outside( cell_box ) )
+        {
+          append_inside_( shape, mask, a, begin, end, result );
+        }
+      }
+
+      // Advance to next cell in range
+      int i = 0;
+      while ( i < D and cell[ i ] == last[ i ] )
+      {
+        cell[ i ] = first[ i ];
+        ++i;
+      }
+      if ( i == D )
+      {
+        break;
+      }
+      ++cell[ i ];
+    }
+  }
+}
+
+} // namespace nest
+
+#endif
@@ -22,6 +22,9 @@
 
 #include "clopath_archiving_node.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 
@@ -158,32 +161,20 @@ nest::ClopathArchivingNode::get_LTD_value( double t )
 void
 nest::ClopathArchivingNode::get_LTP_history( double t1,
   double t2,
-  std::deque< histentry_extended >::iterator* start,
-  std::deque< histentry_extended >::iterator* finish )
+  HistoryBuffer< histentry_extended >::iterator* start,
+  HistoryBuffer< histentry_extended >::iterator* finish )
 {
-  *finish = ltp_history_.end();
-  if ( ltp_history_.empty() )
+  // To have a well defined discretization of the integral, we make sure
+  // that we exclude the entry at t1 but include the one at t2 by subtracting
+  // a small number so that t_ is never equal to t1 or t2. The entries are
+  // sorted by time, so both ends are found by bisection.
+  *start = std::partition_point(
+    ltp_history_.begin(), ltp_history_.end(), [ t1 ]( const histentry_extended& h ) { return h.t_ - 1.0e-6 < t1; } );
+  *finish = std::partition_point(
+    *start, ltp_history_.end(), [ t2 ]( const histentry_extended& h ) { return h.t_ - 1.0e-6 < t2; } );
+  for ( HistoryBuffer< histentry_extended >::iterator runner = *start; runner != *finish; ++runner )
   {
-    *start = *finish;
-    return;
-  }
-  else
-  {
-    std::deque< histentry_extended >::iterator runner = ltp_history_.begin();
-    // To have a well defined discretization of the integral, we make sure
-    // that we exclude the entry at t1 but include the one at t2 by subtracting
-    // a small number so that runner->t_ is never equal to t1 or t2.
-    while ( ( runner != ltp_history_.end() ) && ( runner->t_ - 1.0e-6 < t1 ) )
-    {
-      ++runner;
-    }
-    *start = runner;
-    while ( ( runner != ltp_history_.end() ) && ( runner->t_ - 1.0e-6 < t2 ) )
-    {
-      ( runner->access_counter_ )++;
-      ++runner;
-    }
-    *finish = runner;
+    ++runner->access_counter_;
   }
 }
 
@@ -239,16 +230,12 @@ nest::ClopathArchivingNode::write_LTP_history( const double t_ltp_ms, double u,
   {
     // prune all entries from history which are no longer needed
     // except the penultimate one. we might still need it.
-    while ( ltp_history_.size() > 1 )
+    if ( ltp_history_.size() > 1 )
     {
-      if ( ltp_history_.front().access_counter_ >= n_incoming_ )
-      {
-        ltp_history_.pop_front();
-      }
-      else
-      {
-        break;
-      }
+      const HistoryBuffer< histentry_extended >::iterator first_needed = std::find_if( ltp_history_.begin(),
+        ltp_history_.end() - 1,
+        [ this ]( const histentry_extended& h ) { return h.access_counter_ < n_incoming_; } );
+      ltp_history_.pop_front( first_needed - ltp_history_.begin() );
     }
     // dw is not the change of the synaptic weight since the factor
     // x_bar is not included (but later in the synapse)
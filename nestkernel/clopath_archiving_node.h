@@ -24,11 +24,12 @@
 #define CLOPATH_ARCHIVING_NODE_H
 
 // C++ includes:
-#include <deque>
+#include <vector>
 
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "histentry.h"
+#include "history_buffer.h"
 #include "nest_time.h"
 #include "nest_types.h"
 #include "synaptic_element.h"
@@ -68,15 +69,15 @@ public:
 
   /**
    * \fn void get_LTP_history(long t1, long t2,
-   * std::deque<Archiver::histentry>::iterator* start,
-   * std::deque<Archiver::histentry>::iterator* finish)
+   * HistoryBuffer<histentry_extended>::iterator* start,
+   * HistoryBuffer<histentry_extended>::iterator* finish)
    * Sets pointer start (finish) to the first (last) entry in LTP_history
    * whose time argument is between t1 and t2
    */
   void get_LTP_history( double t1,
     double t2,
-    std::deque< histentry_extended >::iterator* start,
-    std::deque< histentry_extended >::iterator* finish );
+    HistoryBuffer< histentry_extended >::iterator* start,
+    HistoryBuffer< histentry_extended >::iterator* finish );
 
   /**
    * \fn double get_theta_plus()
@@ -122,7 +123,7 @@ protected:
 
 private:
   std::vector< histentry_extended > ltd_history_;
-  std::deque< histentry_extended > ltp_history_;
+  HistoryBuffer< histentry_extended > ltp_history_;
 
   double A_LTD_;
 
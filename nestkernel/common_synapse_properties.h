@@ -96,7 +96,7 @@ public:
   /**
    * get weight_recorder
    */
-  NodeCollectionDatum get_weight_recorder() const;
+  const NodeCollectionDatum& get_weight_recorder() const;
 
 
 private:
@@ -116,7 +116,7 @@ CommonSynapseProperties::get_wr_node_id() const
   return wr_node_id_;
 }
 
-inline NodeCollectionDatum
+inline const NodeCollectionDatum&
 CommonSynapseProperties::get_weight_recorder() const
 {
   return weight_recorder_;
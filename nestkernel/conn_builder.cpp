@@ -22,6 +22,10 @@
 
 #include "conn_builder.h"
 
+// C++ includes:
+#include <algorithm>
+#include <numeric>
+
 // Includes from libnestutil:
 #include "logging.h"
 
@@ -39,6 +43,10 @@
 #include "fdstream.h"
 #include "name.h"
 
+// Includes from thirdparty:
+#include "Random123/conventional/Engine.hpp"
+#include "Random123/philox.h"
+
 nest::ConnBuilder::ConnBuilder( NodeCollectionPTR sources,
   NodeCollectionPTR targets,
   const DictionaryDatum& conn_spec,
@@ -166,8 +174,9 @@ nest::ConnBuilder::change_connected_synaptic_elements( index snode_id, index tno
     Node* const source = kernel().node_manager.get_node_or_proxy( snode_id, tid );
     const thread source_thread = source->get_thread();
 
-    // check whether the source is on our thread
-    if ( tid == source_thread )
+    // check whether the source is on our thread, proxies of nodes on other
+    // threads belong to tid as well
+    if ( not source->is_proxy() and tid == source_thread )
     {
       // update the number of connected synaptic elements
       source->connect_synaptic_element( pre_synaptic_element_name_, update );
@@ -184,7 +193,7 @@ nest::ConnBuilder::change_connected_synaptic_elements( index snode_id, index tno
     Node* const target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
     const thread target_thread = target->get_thread();
     // check whether the target is on our thread
-    if ( tid != target_thread )
+    if ( target->is_proxy() or tid != target_thread )
     {
       local = false;
     }
@@ -1374,7 +1383,15 @@ nest::FixedTotalNumberBuilder::FixedTotalNumberBuilder( NodeCollectionPTR source
   const std::vector< DictionaryDatum >& syn_specs )
   : ConnBuilder( sources, targets, conn_spec, syn_specs )
   , N_( ( *conn_spec )[ names::N ] )
+  , parallel_sampling_( false )
 {
+  updateValue< bool >( conn_spec, names::parallel_sampling, parallel_sampling_ );
+#ifndef HAVE_RANDOM123
+  if ( parallel_sampling_ )
+  {
+    throw NotImplemented( "Parallel sampling in the FixedTotalNumber connector requires Random123 generators." );
+  }
+#endif
 
   // check for potential errors
 
@@ -1406,6 +1423,12 @@ nest::FixedTotalNumberBuilder::FixedTotalNumberBuilder( NodeCollectionPTR source
 void
 nest::FixedTotalNumberBuilder::connect_()
 {
+  if ( parallel_sampling_ )
+  {
+    connect_parallel_();
+    return;
+  }
+
   const int M = kernel().vp_manager.get_num_virtual_processes();
   const long size_sources = sources_->size();
   const long size_targets = targets_->size();
@@ -1413,17 +1436,46 @@ nest::FixedTotalNumberBuilder::connect_()
   // drawing connection ids
 
   // Compute the distribution of targets over processes using the modulo
-  // function
+  // function. Each thread scans a contiguous chunk of the targets, counts
+  // the targets on each virtual process and collects the targets on each
+  // local thread. Merging the chunks in order then yields the same counts
+  // and target lists, in the same order, as a serial scan, independent of
+  // the number of threads.
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::vector< size_t > > number_of_targets_on_vp_in_chunk( num_threads );
+  std::vector< std::vector< std::vector< index > > > local_targets_in_chunk( num_threads );
+
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    const size_t chunk_begin = size_targets * tid / num_threads;
+    const size_t chunk_end = size_targets * ( tid + 1 ) / num_threads;
+
+    std::vector< size_t >& number_of_targets_on_vp = number_of_targets_on_vp_in_chunk[ tid ];
+    std::vector< std::vector< index > >& local_targets = local_targets_in_chunk[ tid ];
+    number_of_targets_on_vp.resize( M, 0 );
+    local_targets.resize( num_threads );
+
+    NodeCollection::const_iterator target_it = targets_->begin() + chunk_begin;
+    for ( size_t t = chunk_begin; t < chunk_end; ++t, ++target_it )
+    {
+      const index tnode_id = ( *target_it ).node_id;
+      const thread vp = kernel().vp_manager.node_id_to_vp( tnode_id );
+      ++number_of_targets_on_vp[ vp ];
+      if ( kernel().vp_manager.is_local_vp( vp ) )
+      {
+        local_targets[ kernel().vp_manager.vp_to_thread( vp ) ].push_back( tnode_id );
+      }
+    }
+  }
+
   std::vector< size_t > number_of_targets_on_vp( M, 0 );
-  std::vector< index > local_targets;
-  local_targets.reserve( size_targets / kernel().mpi_manager.get_num_processes() );
-  for ( size_t t = 0; t < targets_->size(); t++ )
+  for ( thread chunk = 0; chunk < num_threads; ++chunk )
   {
-    int vp = kernel().vp_manager.node_id_to_vp( ( *targets_ )[ t ] );
-    ++number_of_targets_on_vp[ vp ];
-    if ( kernel().vp_manager.is_local_vp( vp ) )
+    for ( int vp = 0; vp < M; ++vp )
     {
-      local_targets.push_back( ( *targets_ )[ t ] );
+      number_of_targets_on_vp[ vp ] += number_of_targets_on_vp_in_chunk[ chunk ][ vp ];
     }
   }
 
@@ -1487,17 +1539,13 @@ nest::FixedTotalNumberBuilder::connect_()
       {
         RngPtr rng = get_vp_specific_rng( tid );
 
-        // gather local target node IDs
+        // gather local target node IDs from all chunks, in order
         std::vector< index > thread_local_targets;
         thread_local_targets.reserve( number_of_targets_on_vp[ vp_id ] );
-
-        std::vector< index >::const_iterator tnode_id_it = local_targets.begin();
-        for ( ; tnode_id_it != local_targets.end(); ++tnode_id_it )
+        for ( thread chunk = 0; chunk < num_threads; ++chunk )
         {
-          if ( kernel().vp_manager.node_id_to_vp( *tnode_id_it ) == vp_id )
-          {
-            thread_local_targets.push_back( *tnode_id_it );
-          }
+          const std::vector< index >& chunk_targets = local_targets_in_chunk[ chunk ][ tid ];
+          thread_local_targets.insert( thread_local_targets.end(), chunk_targets.begin(), chunk_targets.end() );
         }
 
         assert( thread_local_targets.size() == number_of_targets_on_vp[ vp_id ] );
@@ -1537,6 +1585,203 @@ nest::FixedTotalNumberBuilder::connect_()
   }
 }
 
+void
+nest::FixedTotalNumberBuilder::connect_parallel_()
+{
+#ifdef HAVE_RANDOM123
+  typedef RandomGenerator< r123::Engine< r123::Philox4x32 > > StreamRng;
+
+  // Seeders separating the streams of the tree from those of the targets
+  const std::uint32_t TREE_SEEDER = 0x1d2f8a73;
+  const std::uint32_t TARGET_SEEDER = 0x6b03c51e;
+
+  const size_t size_sources = sources_->size();
+  const size_t size_targets = targets_->size();
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+
+  // Key all streams of this call by numbers from the rank-synchronized RNG,
+  // which are identical on all ranks and differ between calls.
+  RngPtr grng = get_rank_synced_rng();
+  const std::uint32_t key_0 = grng->ulrand( 1UL << 32 );
+  const std::uint32_t key_1 = grng->ulrand( 1UL << 32 );
+
+  // Each thread scans a contiguous chunk of the targets and collects the
+  // indices of the targets on each local thread. Without autapses, it also
+  // marks the targets that are sources, which have one source less to
+  // connect to.
+  std::vector< std::vector< std::vector< size_t > > > local_targets_in_chunk( num_threads );
+  std::vector< size_t > sources_before_target;
+  if ( not allow_autapses_ )
+  {
+    sources_before_target.resize( size_targets + 1, 0 );
+  }
+
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    const size_t chunk_begin = size_targets * tid / num_threads;
+    const size_t chunk_end = size_targets * ( tid + 1 ) / num_threads;
+
+    std::vector< std::vector< size_t > >& local_targets = local_targets_in_chunk[ tid ];
+    local_targets.resize( num_threads );
+
+    NodeCollection::const_iterator target_it = targets_->begin() + chunk_begin;
+    for ( size_t t = chunk_begin; t < chunk_end; ++t, ++target_it )
+    {
+      const index tnode_id = ( *target_it ).node_id;
+      const thread vp = kernel().vp_manager.node_id_to_vp( tnode_id );
+      if ( kernel().vp_manager.is_local_vp( vp ) )
+      {
+        local_targets[ kernel().vp_manager.vp_to_thread( vp ) ].push_back( t );
+      }
+      if ( not allow_autapses_ and sources_->find( tnode_id ) >= 0 )
+      {
+        sources_before_target[ t + 1 ] = 1;
+      }
+    }
+  }
+
+  std::partial_sum( sources_before_target.begin(), sources_before_target.end(), sources_before_target.begin() );
+
+  // Number of source-target pairs with targets in [begin, end)
+  auto num_pairs = [&]( const size_t begin, const size_t end ) -> double
+  {
+    double num = static_cast< double >( end - begin ) * size_sources;
+    if ( not allow_autapses_ )
+    {
+      num -= sources_before_target[ end ] - sources_before_target[ begin ];
+    }
+    return num;
+  };
+
+  if ( N_ > 0 and num_pairs( 0, size_targets ) == 0 )
+  {
+    throw BadProperty( "No source-target pairs available for the FixedTotalNumber connector." );
+  }
+
+#pragma omp parallel
+  {
+    // get thread id
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      const int vp_id = kernel().vp_manager.thread_to_vp( tid );
+
+      if ( kernel().vp_manager.is_local_vp( vp_id ) )
+      {
+        // gather local target indices from all chunks, in order
+        std::vector< size_t > thread_local_targets;
+        for ( thread chunk = 0; chunk < num_threads; ++chunk )
+        {
+          const std::vector< size_t >& chunk_targets = local_targets_in_chunk[ chunk ][ tid ];
+          thread_local_targets.insert( thread_local_targets.end(), chunk_targets.begin(), chunk_targets.end() );
+        }
+
+        // Split the connections over the targets [begin, end) by drawing the
+        // number of connections to the first half. Node k of the tree has the
+        // children 2k and 2k + 1, and draws from its own stream, so that all
+        // threads reaching a node draw the same split. Subtrees without
+        // connections or without local targets are skipped.
+        struct Subtree
+        {
+          size_t node;
+          size_t begin;
+          size_t end;
+          unsigned long num_conns;
+          size_t local_begin; // range of local targets in thread_local_targets
+          size_t local_end;
+        };
+
+        std::vector< unsigned long > num_conns_on_target( thread_local_targets.size(), 0 );
+        std::vector< Subtree > subtrees;
+        subtrees.push_back( { 1, 0, size_targets, static_cast< unsigned long >( N_ ), 0, thread_local_targets.size() } );
+
+        while ( not subtrees.empty() )
+        {
+          const Subtree subtree = subtrees.back();
+          subtrees.pop_back();
+
+          if ( subtree.num_conns == 0 or subtree.local_begin == subtree.local_end )
+          {
+            continue;
+          }
+          if ( subtree.end - subtree.begin == 1 )
+          {
+            num_conns_on_target[ subtree.local_begin ] = subtree.num_conns;
+            continue;
+          }
+
+          const size_t mid = subtree.begin + ( subtree.end - subtree.begin ) / 2;
+          const double p_first = num_pairs( subtree.begin, mid ) / num_pairs( subtree.begin, subtree.end );
+
+          StreamRng rng( { key_0,
+            key_1,
+            TREE_SEEDER,
+            static_cast< std::uint32_t >( subtree.node ),
+            static_cast< std::uint32_t >( subtree.node >> 32 ) } );
+          // A fresh distribution per node, as std::binomial_distribution may
+          // carry state from one draw to the next.
+          binomial_distribution bino_dist;
+          binomial_distribution::param_type param( subtree.num_conns, p_first );
+          const unsigned long num_conns_first = bino_dist( &rng, param );
+
+          const size_t local_mid = std::lower_bound( thread_local_targets.begin() + subtree.local_begin,
+                                     thread_local_targets.begin() + subtree.local_end,
+                                     mid ) - thread_local_targets.begin();
+
+          subtrees.push_back(
+            { 2 * subtree.node + 1, mid, subtree.end, subtree.num_conns - num_conns_first, local_mid, subtree.local_end } );
+          subtrees.push_back(
+            { 2 * subtree.node, subtree.begin, mid, num_conns_first, subtree.local_begin, local_mid } );
+        }
+
+        for ( size_t i = 0; i < thread_local_targets.size(); ++i )
+        {
+          unsigned long num_conns = num_conns_on_target[ i ];
+          if ( num_conns == 0 )
+          {
+            continue;
+          }
+
+          // Sources and connection parameters of a target are drawn from the
+          // stream of the target.
+          const size_t t_index = thread_local_targets[ i ];
+          StreamRng rng( { key_0,
+            key_1,
+            TARGET_SEEDER,
+            static_cast< std::uint32_t >( t_index ),
+            static_cast< std::uint32_t >( t_index >> 32 ) } );
+
+          const index tnode_id = ( *targets_ )[ t_index ];
+          Node* const target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
+          const thread target_thread = target->get_thread();
+
+          while ( num_conns > 0 )
+          {
+            const index snode_id = ( *sources_ )[ rng.ulrand( size_sources ) ];
+            if ( allow_autapses_ or snode_id != tnode_id )
+            {
+              single_connect_( snode_id, *target, target_thread, &rng );
+              --num_conns;
+            }
+          }
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+#else
+  assert( false ); // rejected by the constructor
+#endif
+}
+
 
 nest::BernoulliBuilder::BernoulliBuilder( NodeCollectionPTR sources,
   NodeCollectionPTR targets,
@@ -1814,11 +2059,23 @@ nest::SPBuilder::update_delay( delay& d ) const
 }
 
 void
-nest::SPBuilder::sp_connect( const std::vector< index >& sources, const std::vector< index >& targets )
+nest::SPBuilder::sp_connect( const std::vector< index >& sources, const std::vector< index >& targets, const thread tid )
 {
-  connect_( sources, targets );
+  try
+  {
+    connect_( sources, targets, tid );
+  }
+  catch ( std::exception& err )
+  {
+    // We must create a new exception here, err's lifetime ends at
+    // the end of the catch block.
+    exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+  }
+}
 
-  // check if any exceptions have been raised
+void
+nest::SPBuilder::check_exceptions() const
+{
   for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
   {
     if ( exceptions_raised_.at( tid ).get() )
@@ -1843,7 +2100,7 @@ void nest::SPBuilder::connect_( NodeCollectionPTR, NodeCollectionPTR )
 }
 
 void
-nest::SPBuilder::connect_( const std::vector< index >& sources, const std::vector< index >& targets )
+nest::SPBuilder::connect_( const std::vector< index >& sources, const std::vector< index >& targets, const thread tid )
 {
   // Code copied and adapted from OneToOneBuilder::connect_()
   // make sure that target and source population have the same size
@@ -1852,41 +2109,26 @@ nest::SPBuilder::connect_( const std::vector< index >& sources, const std::vecto
     throw DimensionMismatch( "Source and target population must be of the same size." );
   }
 
-#pragma omp parallel
+  RngPtr rng = get_vp_specific_rng( tid );
+
+  std::vector< index >::const_iterator tnode_id_it = targets.begin();
+  std::vector< index >::const_iterator snode_id_it = sources.begin();
+  for ( ; tnode_id_it != targets.end(); ++tnode_id_it, ++snode_id_it )
   {
-    // get thread id
-    const thread tid = kernel().vp_manager.get_thread_id();
+    assert( snode_id_it != sources.end() );
 
-    try
+    if ( *snode_id_it == *tnode_id_it and not allow_autapses_ )
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
-      std::vector< index >::const_iterator tnode_id_it = targets.begin();
-      std::vector< index >::const_iterator snode_id_it = sources.begin();
-      for ( ; tnode_id_it != targets.end(); ++tnode_id_it, ++snode_id_it )
-      {
-        assert( snode_id_it != sources.end() );
-
-        if ( *snode_id_it == *tnode_id_it and not allow_autapses_ )
-        {
-          continue;
-        }
-
-        if ( not change_connected_synaptic_elements( *snode_id_it, *tnode_id_it, tid, 1 ) )
-        {
-          skip_conn_parameter_( tid );
-          continue;
-        }
-        Node* const target = kernel().node_manager.get_node_or_proxy( *tnode_id_it, tid );
-
-        single_connect_( *snode_id_it, *target, tid, rng );
-      }
+      continue;
     }
-    catch ( std::exception& err )
+
+    if ( not change_connected_synaptic_elements( *snode_id_it, *tnode_id_it, tid, 1 ) )
     {
-      // We must create a new exception here, err's lifetime ends at
-      // the end of the catch block.
-      exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+      skip_conn_parameter_( tid );
+      continue;
     }
+    Node* const target = kernel().node_manager.get_node_or_proxy( *tnode_id_it, tid );
+
+    single_connect_( *snode_id_it, *target, tid, rng );
   }
 }
@@ -361,7 +361,19 @@ protected:
   void connect_();
 
 private:
+  /**
+   * Create the connections independently of the number of virtual processes.
+   *
+   * The total number of connections is split over the targets by a binary tree
+   * of binomial draws, and the sources of each target are drawn from a random
+   * stream of its own. All streams are counter-based and keyed by their
+   * position in the tree or the target population, so each thread only draws
+   * the parts of the tree leading to its own targets.
+   */
+  void connect_parallel_();
+
   long N_;
+  bool parallel_sampling_; //!< use connect_parallel_()
 };
 
 class BernoulliBuilder : public ConnBuilder
@@ -428,9 +440,14 @@ public:
   void update_delay( delay& d ) const;
 
   /**
+   * Create the synapses from sources to targets on the given thread and
+   * keep exceptions for check_exceptions(). Called by all threads.
    *  @note Only for internal use by SPManager.
    */
-  void sp_connect( const std::vector< index >& sources, const std::vector< index >& targets );
+  void sp_connect( const std::vector< index >& sources, const std::vector< index >& targets, const thread tid );
+
+  //! Throw the first exception raised by sp_connect() on any thread
+  void check_exceptions() const;
 
 protected:
   using ConnBuilder::connect_;
@@ -441,8 +458,9 @@ protected:
    * In charge of dynamically creating the new synapses
    * @param sources nodes from which synapses can be created
    * @param targets target nodes for the newly created synapses
+   * @param tid thread to create the synapses on
    */
-  void connect_( const std::vector< index >& sources, const std::vector< index >& targets );
+  void connect_( const std::vector< index >& sources, const std::vector< index >& targets, const thread tid );
 };
 
 inline void
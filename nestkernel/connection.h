@@ -238,6 +238,17 @@ public:
     return target_.get_rport();
   }
 
+  /**
+   * Set the target of the connection without checking the connection.
+   * Only used to restore connections from a network snapshot, where the
+   * connection has been checked when it was created.
+   */
+  void
+  set_target( Node* target )
+  {
+    target_.set_target( target );
+  }
+
   /**
    * Sets a flag in the connection to signal that the following connection has
    * the same source.
@@ -30,6 +30,9 @@ ConnectionCreator::ConnectionCreator( DictionaryDatum dict )
   : allow_autapses_( true )
   , allow_multapses_( true )
   , allow_oversized_( false )
+  , partition_positions_( false )
+  , alias_sampling_( false )
+  , use_cell_list_( false )
   , number_of_connections_()
   , mask_()
   , kernel_()
@@ -44,6 +47,9 @@ ConnectionCreator::ConnectionCreator( DictionaryDatum dict )
   updateValue< bool >( dict, names::allow_autapses, allow_autapses_ );
   updateValue< bool >( dict, names::allow_multapses, allow_multapses_ );
   updateValue< bool >( dict, names::allow_oversized_mask, allow_oversized_ );
+  updateValue< bool >( dict, names::partition_positions, partition_positions_ );
+  updateValue< bool >( dict, names::alias_sampling, alias_sampling_ );
+  updateValue< bool >( dict, names::use_cell_list, use_cell_list_ );
 
   // Need to store number of connections in a temporary variable to be able to detect negative values.
   if ( updateValue< long >( dict, names::number_of_connections, number_of_connections ) )
@@ -141,6 +147,18 @@ ConnectionCreator::ConnectionCreator( DictionaryDatum dict )
   {
     throw BadProperty( "Unknown connection type." );
   }
+
+  if ( partition_positions_ )
+  {
+    if ( not mask_.get() )
+    {
+      throw BadProperty( "partition_positions requires a mask." );
+    }
+    if ( type_ == Fixed_outdegree )
+    {
+      throw BadProperty( "partition_positions is not possible with fixed outdegree." );
+    }
+  }
 }
 
 void
@@ -24,9 +24,11 @@
 #define CONNECTION_CREATOR_H
 
 // C++ includes:
+#include <map>
 #include <vector>
 
 // Includes from nestkernel:
+#include "alias_table.h"
 #include "kernel_manager.h"
 #include "nest_names.h"
 #include "nestmodule.h"
@@ -43,6 +45,9 @@ class Layer;
 template < int D >
 class MaskedLayer;
 
+template < int D >
+class GridLayer;
+
 /**
  * This class is a representation of the dictionary of connection
  * properties given as an argument to the ConnectLayers function. The
@@ -78,6 +83,19 @@ public:
    * - "allow_autapses": Boolean, true if autapses are allowed.
    * - "allow_multapses": Boolean, true if multapses are allowed.
    * - "allow_oversized": Boolean, true if oversized masks are allowed.
+   * - "partition_positions": Boolean, if true, each MPI process only
+   *   fetches positions of sources which may lie inside the mask of one
+   *   of its local targets, instead of the positions of all sources.
+   *   Requires a mask and a target driven connection type.
+   * - "alias_sampling": Boolean, if true, connections with a fixed number
+   *   of connections are drawn from Walker alias tables, see
+   *   GridAliasTables_. For grid layers with periodic boundary conditions,
+   *   the kernel must then only depend on the displacement.
+   * - "use_cell_list": Boolean, if true, the nodes inside the mask are
+   *   queried from a CellList instead of the Ntree of the layer. This is
+   *   faster for large layers and small masks, but visits the nodes in a
+   *   different order, so that the connections drawn for a given seed
+   *   differ from those obtained with the Ntree.
    * - "number_of_connections": Integer, number of connections to make
    *   for each source or target.
    * - "mask": Mask definition (dictionary or masktype).
@@ -109,6 +127,10 @@ private:
    *
    * The purpose is to avoid code doubling for cases with and without masks.
    * Essentially, the class works as a fancy union.
+   *
+   * For masked pools, mask queries may use a cell list instead of the
+   * ntree. Nodes inside the mask must then be obtained with
+   * get_masked_nodes() instead of the masked iterators.
    */
   template < int D >
   class PoolWrapper_
@@ -116,22 +138,127 @@ private:
   public:
     PoolWrapper_();
     ~PoolWrapper_();
-    void define( MaskedLayer< D >* );
+    void define( MaskedLayer< D >*, bool use_cell_list, bool sort_masked_nodes = false );
     void define( std::vector< std::pair< Position< D >, index > >* );
 
     typename Ntree< D, index >::masked_iterator masked_begin( const Position< D >& pos ) const;
     typename Ntree< D, index >::masked_iterator masked_end() const;
 
+    /**
+     * @returns true if mask queries use a cell list
+     */
+    bool uses_cell_list() const;
+
+    /**
+     * Append nodes inside the mask centered on pos to the given vector.
+     * If the pool was defined with sort_masked_nodes, the appended nodes
+     * are sorted by node ID.
+     */
+    void get_masked_nodes( const Position< D >& pos, std::vector< std::pair< Position< D >, index > >& nodes ) const;
+
     typename std::vector< std::pair< Position< D >, index > >::iterator begin() const;
     typename std::vector< std::pair< Position< D >, index > >::iterator end() const;
 
   private:
     MaskedLayer< D >* masked_layer_;
     std::vector< std::pair< Position< D >, index > >* positions_;
+    bool use_cell_list_;
+    bool sort_masked_nodes_;
+  };
+
+  /**
+   * Alias tables for drawing nodes of a grid layer with periodic boundary
+   * conditions from inside a mask.
+   *
+   * With periodic boundary conditions, the nodes inside the mask are the
+   * same up to a shift of grid positions for all anchors at the same
+   * position relative to the grid. If the kernel only depends on the
+   * displacement, so do the connection probabilities, and a single alias
+   * table can be shared by all such anchors. Nodes are then drawn in
+   * constant time by adding the drawn grid offset to the grid position of
+   * the anchor.
+   */
+  template < int D >
+  class GridAliasTables_
+  {
+  public:
+    struct Entry
+    {
+      AliasTable table;
+      std::vector< Position< D, int > > offsets; //!< grid offsets of the nodes relative to the anchor
+    };
+
+    GridAliasTables_( const GridLayer< D >& layer, NodeCollectionPTR node_collection );
+
+    /**
+     * @returns true if tables can be shared for the given layer, i.e., if it
+     * is a grid layer with periodic boundary conditions in all dimensions.
+     */
+    static bool is_applicable( const Layer< D >& layer, NodeCollectionPTR node_collection );
+
+    /**
+     * Find the table for the mask centered on the anchor.
+     * @param anchor position of the anchor.
+     * @param base   set to the grid position which offsets are relative to.
+     * @returns table or nullptr if no table was inserted for the anchor.
+     */
+    const Entry* find( const Position< D >& anchor, Position< D, int >& base ) const;
+
+    /**
+     * Insert a table for the mask centered on the anchor.
+     * @param anchor        position of the anchor.
+     * @param nodes         nodes inside the mask.
+     * @param probabilities connection probabilities of the nodes.
+     */
+    const Entry& insert( const Position< D >& anchor,
+      const std::vector< std::pair< Position< D >, index > >& nodes,
+      const std::vector< double >& probabilities );
+
+    /**
+     * Get node with the given index in the table of an anchor at grid
+     * position base.
+     */
+    void get_node( const Entry& entry,
+      const Position< D, int >& base,
+      index k,
+      std::pair< Position< D >, index >& node ) const;
+
+    /**
+     * Draw a node from the table of an anchor at grid position base.
+     * @returns index of the drawn node in the table.
+     */
+    index draw( const Entry& entry,
+      const Position< D, int >& base,
+      RngPtr rng,
+      std::pair< Position< D >, index >& node ) const;
+
+  private:
+    //! Continuous grid coordinates of a position, in the matrix convention of GridLayer.
+    Position< D > grid_coordinates_( const Position< D >& pos ) const;
+
+    //! Key identifying the position of an anchor relative to the grid.
+    std::vector< long > key_( const Position< D >& anchor, Position< D, int >& base ) const;
+
+    const GridLayer< D >& layer_;
+    NodeCollectionPTR node_collection_;
+    std::map< std::vector< long >, Entry > tables_;
   };
 
   void extract_params_( const DictionaryDatum&, std::vector< DictionaryDatum >& );
 
+  /**
+   * Get the candidate sources for a target and their connection
+   * probabilities. Throws if there are not enough sources to draw from.
+   */
+  template < int D >
+  void get_sources_( const PoolWrapper_< D >& pool,
+    Layer< D >& source,
+    const Position< D >& target_pos,
+    Node* tgt,
+    RngPtr rng,
+    std::vector< std::pair< Position< D >, index > >& positions,
+    std::vector< double >& probabilities ) const;
+
   template < typename Iterator, int D >
   void connect_to_target_( Iterator from,
     Iterator to,
@@ -156,6 +283,23 @@ private:
   void
   fixed_indegree_( Layer< D >& source, NodeCollectionPTR source_nc, Layer< D >& target, NodeCollectionPTR target_nc );
 
+  /**
+   * @returns bounding box of the positions of the MPI-local nodes of the
+   * target layer. The box is empty if there are no local nodes.
+   */
+  template < int D >
+  Box< D > get_local_region_( Layer< D >& target, NodeCollectionPTR target_nc ) const;
+
+  /**
+   * fixed_indegree_ drawing sources from alias tables, in parallel for the
+   * targets on each thread.
+   */
+  template < int D >
+  void fixed_indegree_alias_( Layer< D >& source,
+    NodeCollectionPTR source_nc,
+    Layer< D >& target,
+    NodeCollectionPTR target_nc );
+
   template < int D >
   void
   fixed_outdegree_( Layer< D >& source, NodeCollectionPTR source_nc, Layer< D >& target, NodeCollectionPTR target_nc );
@@ -164,6 +308,9 @@ private:
   bool allow_autapses_;
   bool allow_multapses_;
   bool allow_oversized_;
+  bool partition_positions_;
+  bool alias_sampling_;
+  bool use_cell_list_;
   index number_of_connections_;
   std::shared_ptr< AbstractMask > mask_;
   std::shared_ptr< Parameter > kernel_;
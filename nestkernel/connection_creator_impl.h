@@ -26,9 +26,15 @@
 #include "connection_creator.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <vector>
 
 // Includes from nestkernel:
+#include "grid_layer.h"
 #include "kernel_manager.h"
 #include "nest.h"
 
@@ -114,6 +120,8 @@ template < int D >
 ConnectionCreator::PoolWrapper_< D >::PoolWrapper_()
   : masked_layer_( 0 )
   , positions_( 0 )
+  , use_cell_list_( false )
+  , sort_masked_nodes_( false )
 {
 }
 
@@ -128,12 +136,18 @@ ConnectionCreator::PoolWrapper_< D >::~PoolWrapper_< D >()
 
 template < int D >
 void
-ConnectionCreator::PoolWrapper_< D >::define( MaskedLayer< D >* ml )
+ConnectionCreator::PoolWrapper_< D >::define( MaskedLayer< D >* ml, bool use_cell_list, bool sort_masked_nodes )
 {
   assert( masked_layer_ == 0 );
   assert( positions_ == 0 );
   assert( ml != 0 );
   masked_layer_ = ml;
+  if ( use_cell_list )
+  {
+    masked_layer_->build_cell_list();
+  }
+  use_cell_list_ = use_cell_list;
+  sort_masked_nodes_ = sort_masked_nodes;
 }
 
 template < int D >
@@ -160,6 +174,30 @@ ConnectionCreator::PoolWrapper_< D >::masked_end() const
   return masked_layer_->end();
 }
 
+template < int D >
+bool
+ConnectionCreator::PoolWrapper_< D >::uses_cell_list() const
+{
+  return use_cell_list_;
+}
+
+template < int D >
+void
+ConnectionCreator::PoolWrapper_< D >::get_masked_nodes( const Position< D >& pos,
+  std::vector< std::pair< Position< D >, index > >& nodes ) const
+{
+  const size_t first = nodes.size();
+  masked_layer_->get_nodes( pos, nodes );
+
+  if ( sort_masked_nodes_ )
+  {
+    std::sort( nodes.begin() + first,
+      nodes.end(),
+      []( const std::pair< Position< D >, index >& a, const std::pair< Position< D >, index >& b )
+      { return a.second < b.second; } );
+  }
+}
+
 template < int D >
 typename std::vector< std::pair< Position< D >, index > >::iterator
 ConnectionCreator::PoolWrapper_< D >::begin() const
@@ -175,6 +213,219 @@ ConnectionCreator::PoolWrapper_< D >::end() const
 }
 
 
+template < int D >
+ConnectionCreator::GridAliasTables_< D >::GridAliasTables_( const GridLayer< D >& layer,
+  NodeCollectionPTR node_collection )
+  : layer_( layer )
+  , node_collection_( node_collection )
+  , tables_()
+{
+}
+
+template < int D >
+bool
+ConnectionCreator::GridAliasTables_< D >::is_applicable( const Layer< D >& layer, NodeCollectionPTR node_collection )
+{
+  const GridLayer< D >* grid_layer = dynamic_cast< const GridLayer< D >* >( &layer );
+  if ( grid_layer == 0 or not layer.get_periodic_mask().all() )
+  {
+    return false;
+  }
+
+  // Nodes are identified by their grid position, so the node collection must contain the whole layer.
+  const Position< D, index > dims = grid_layer->get_dims();
+  index num_nodes = 1;
+  for ( int i = 0; i < D; ++i )
+  {
+    num_nodes *= dims[ i ];
+  }
+  return node_collection->size() == num_nodes;
+}
+
+template < int D >
+Position< D >
+ConnectionCreator::GridAliasTables_< D >::grid_coordinates_( const Position< D >& pos ) const
+{
+  const Position< D > lower_left = layer_.get_lower_left();
+  const Position< D > extent = layer_.get_extent();
+  const Position< D, index > dims = layer_.get_dims();
+
+  Position< D > x;
+  for ( int i = 0; i < D; ++i )
+  {
+    x[ i ] = ( pos[ i ] - lower_left[ i ] ) * dims[ i ] / extent[ i ] - 0.5;
+  }
+  if ( D > 1 )
+  {
+    // grid layer uses "matrix convention", i.e. reversed y axis
+    x[ 1 ] = dims[ 1 ] - 1 - x[ 1 ];
+  }
+  return x;
+}
+
+template < int D >
+std::vector< long >
+ConnectionCreator::GridAliasTables_< D >::key_( const Position< D >& anchor, Position< D, int >& base ) const
+{
+  // Anchors closer than this fraction of the grid spacing are considered at the same position relative to the grid
+  const double resolution = 1e-6;
+
+  const Position< D > x = grid_coordinates_( anchor );
+  std::vector< long > key( D );
+  for ( int i = 0; i < D; ++i )
+  {
+    base[ i ] = std::lround( x[ i ] );
+    key[ i ] = std::lround( ( x[ i ] - base[ i ] ) / resolution );
+  }
+  return key;
+}
+
+template < int D >
+const typename ConnectionCreator::GridAliasTables_< D >::Entry*
+ConnectionCreator::GridAliasTables_< D >::find( const Position< D >& anchor, Position< D, int >& base ) const
+{
+  const auto it = tables_.find( key_( anchor, base ) );
+  return it == tables_.end() ? nullptr : &it->second;
+}
+
+template < int D >
+const typename ConnectionCreator::GridAliasTables_< D >::Entry&
+ConnectionCreator::GridAliasTables_< D >::insert( const Position< D >& anchor,
+  const std::vector< std::pair< Position< D >, index > >& nodes,
+  const std::vector< double >& probabilities )
+{
+  Position< D, int > base;
+  Entry& entry = tables_[ key_( anchor, base ) ];
+
+  entry.table.build( probabilities );
+  entry.offsets.clear();
+  entry.offsets.reserve( nodes.size() );
+  for ( const auto& node : nodes )
+  {
+    const Position< D > x = grid_coordinates_( node.first );
+    Position< D, int > offset;
+    for ( int i = 0; i < D; ++i )
+    {
+      offset[ i ] = std::lround( x[ i ] ) - base[ i ];
+    }
+    entry.offsets.push_back( offset );
+  }
+  return entry;
+}
+
+template < int D >
+void
+ConnectionCreator::GridAliasTables_< D >::get_node( const Entry& entry,
+  const Position< D, int >& base,
+  index k,
+  std::pair< Position< D >, index >& node ) const
+{
+  Position< D, int > gridpos;
+  for ( int i = 0; i < D; ++i )
+  {
+    gridpos[ i ] = base[ i ] + entry.offsets[ k ][ i ];
+  }
+  const index lid = layer_.gridpos_to_lid( gridpos );
+  node.first = layer_.lid_to_position( lid );
+  node.second = node_collection_->operator[]( lid );
+}
+
+template < int D >
+index
+ConnectionCreator::GridAliasTables_< D >::draw( const Entry& entry,
+  const Position< D, int >& base,
+  RngPtr rng,
+  std::pair< Position< D >, index >& node ) const
+{
+  const index k = entry.table( rng );
+  get_node( entry, base, k, node );
+  return k;
+}
+
+template < int D >
+void
+ConnectionCreator::get_sources_( const PoolWrapper_< D >& pool,
+  Layer< D >& source,
+  const Position< D >& target_pos,
+  Node* tgt,
+  RngPtr rng,
+  std::vector< std::pair< Position< D >, index > >& positions,
+  std::vector< double >& probabilities ) const
+{
+  const index target_id = tgt->get_node_id();
+
+  // Get (position,node ID) pairs for sources inside mask
+  positions.clear();
+  if ( mask_.get() )
+  {
+    pool.get_masked_nodes( target_pos, positions );
+  }
+  else
+  {
+    positions.assign( pool.begin(), pool.end() );
+  }
+
+  if ( positions.empty()
+    or ( ( not allow_autapses_ ) and ( positions.size() == 1 ) and ( positions[ 0 ].second == target_id ) )
+    or ( ( not allow_multapses_ ) and ( positions.size() < number_of_connections_ ) ) )
+  {
+    std::string msg = String::compose( "Global target ID %1: Not enough sources found inside mask", target_id );
+    throw KernelException( msg.c_str() );
+  }
+
+  probabilities.clear();
+  if ( kernel_.get() )
+  {
+    std::vector< double > source_pos_vector( D );
+    const std::vector< double > target_pos_vector = target_pos.get_vector();
+
+    probabilities.reserve( positions.size() );
+    for ( const auto& position : positions )
+    {
+      position.first.get_vector( source_pos_vector );
+      probabilities.push_back( kernel_->value( rng, source_pos_vector, target_pos_vector, source, tgt ) );
+    }
+
+    if ( std::accumulate( probabilities.begin(), probabilities.end(), 0.0 ) <= 0.0 )
+    {
+      std::string msg = String::compose( "Global target ID %1: Connection probability is zero for all sources", target_id );
+      throw KernelException( msg.c_str() );
+    }
+  }
+  else
+  {
+    probabilities.resize( positions.size(), 1.0 );
+  }
+}
+
+template < int D >
+Box< D >
+ConnectionCreator::get_local_region_( Layer< D >& target, NodeCollectionPTR target_nc ) const
+{
+  Position< D > lower_left;
+  Position< D > upper_right;
+  for ( int i = 0; i < D; ++i )
+  {
+    lower_left[ i ] = std::numeric_limits< double >::infinity();
+    upper_right[ i ] = -std::numeric_limits< double >::infinity();
+  }
+
+  // Nodes without proxies are present on all MPI processes.
+  NodeCollection::const_iterator target_begin =
+    target_nc->has_proxies() ? target_nc->MPI_local_begin() : target_nc->begin();
+  for ( NodeCollection::const_iterator tgt_it = target_begin; tgt_it < target_nc->end(); ++tgt_it )
+  {
+    const Position< D > target_pos = target.get_position( ( *tgt_it ).lid );
+    for ( int i = 0; i < D; ++i )
+    {
+      lower_left[ i ] = std::min( lower_left[ i ], target_pos[ i ] );
+      upper_right[ i ] = std::max( upper_right[ i ], target_pos[ i ] );
+    }
+  }
+
+  return Box< D >( lower_left, upper_right );
+}
+
 template < int D >
 void
 ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
@@ -190,9 +441,15 @@ ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
 
   // retrieve global positions, either for masked or unmasked pool
   PoolWrapper_< D > pool;
-  if ( mask_.get() ) // MaskedLayer will be freed by PoolWrapper d'tor
+  if ( mask_.get() and partition_positions_ )
+  {
+    const Box< D > local_region = get_local_region_( target, target_nc );
+    pool.define(
+      new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc, &local_region ), use_cell_list_, true );
+  }
+  else if ( mask_.get() ) // MaskedLayer will be freed by PoolWrapper d'tor
   {
-    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc ) );
+    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc ), use_cell_list_ );
   }
   else
   {
@@ -211,6 +468,9 @@ ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
       NodeCollection::const_iterator target_begin = target_nc->begin();
       NodeCollection::const_iterator target_end = target_nc->end();
 
+      // Sources inside the mask, if queried from a cell list or sorted
+      std::vector< std::pair< Position< D >, index > > masked_sources;
+
       for ( NodeCollection::const_iterator tgt_it = target_begin; tgt_it < target_end; ++tgt_it )
       {
         Node* const tgt = kernel().node_manager.get_node_or_proxy( ( *tgt_it ).node_id, thread_id );
@@ -219,7 +479,13 @@ ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
         {
           const Position< D > target_pos = target.get_position( ( *tgt_it ).lid );
 
-          if ( mask_.get() )
+          if ( mask_.get() and ( pool.uses_cell_list() or partition_positions_ ) )
+          {
+            masked_sources.clear();
+            pool.get_masked_nodes( target_pos, masked_sources );
+            connect_to_target_( masked_sources.begin(), masked_sources.end(), tgt, target_pos, thread_id, source );
+          }
+          else if ( mask_.get() )
           {
             connect_to_target_(
               pool.masked_begin( target_pos ), pool.masked_end(), tgt, target_pos, thread_id, source );
@@ -267,11 +533,18 @@ ConnectionCreator::pairwise_bernoulli_on_target_( Layer< D >& source,
   //     connection conditionally
 
   PoolWrapper_< D > pool;
-  if ( mask_.get() ) // MaskedLayer will be freed by PoolWrapper d'tor
+  if ( mask_.get() and partition_positions_ )
+  {
+    // Only fetch positions of sources which may be inside the mask of a local target
+    const Box< D > local_region = get_local_region_( target, target_nc );
+    pool.define(
+      new MaskedLayer< D >( source, mask_, allow_oversized_, target, source_nc, &local_region ), use_cell_list_, true );
+  }
+  else if ( mask_.get() ) // MaskedLayer will be freed by PoolWrapper d'tor
   {
     // By supplying the target layer to the MaskedLayer constructor, the
     // mask is mirrored so it may be applied to the source layer instead
-    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, target, source_nc ) );
+    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, target, source_nc ), use_cell_list_ );
   }
   else
   {
@@ -297,6 +570,9 @@ ConnectionCreator::pairwise_bernoulli_on_target_( Layer< D >& source,
       NodeCollection::const_iterator target_begin = target_nc->local_begin();
       NodeCollection::const_iterator target_end = target_nc->end();
 
+      // Sources inside the mask, if queried from a cell list or sorted
+      std::vector< std::pair< Position< D >, index > > masked_sources;
+
       for ( NodeCollection::const_iterator tgt_it = target_begin; tgt_it < target_end; ++tgt_it )
       {
         Node* const tgt = kernel().node_manager.get_node_or_proxy( ( *tgt_it ).node_id, thread_id );
@@ -305,7 +581,15 @@ ConnectionCreator::pairwise_bernoulli_on_target_( Layer< D >& source,
 
         const Position< D > target_pos = target.get_position( ( *tgt_it ).lid );
 
-        if ( mask_.get() )
+        if ( mask_.get() and ( pool.uses_cell_list() or partition_positions_ ) )
+        {
+          // We do the same as in the target driven case, except that we calculate displacements in the target layer.
+          // We therefore send in target as last parameter.
+          masked_sources.clear();
+          pool.get_masked_nodes( target_pos, masked_sources );
+          connect_to_target_( masked_sources.begin(), masked_sources.end(), tgt, target_pos, thread_id, target );
+        }
+        else if ( mask_.get() )
         {
           // We do the same as in the target driven case, except that we calculate displacements in the target layer.
           // We therefore send in target as last parameter.
@@ -376,10 +660,26 @@ ConnectionCreator::fixed_indegree_( Layer< D >& source,
     assert( not tgt->is_proxy() );
   }
 
+  if ( alias_sampling_ )
+  {
+    fixed_indegree_alias_( source, source_nc, target, target_nc );
+    return;
+  }
+
   if ( mask_.get() )
   {
-    MaskedLayer< D > masked_source( source, mask_, allow_oversized_, source_nc );
-    const auto masked_source_end = masked_source.end();
+    PoolWrapper_< D > pool;
+    if ( partition_positions_ )
+    {
+      // Only fetch positions of sources which may be inside the mask of a local target
+      const Box< D > local_region = get_local_region_( target, target_nc );
+      pool.define(
+        new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc, &local_region ), use_cell_list_, true );
+    }
+    else
+    {
+      pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc ), use_cell_list_ );
+    }
 
     std::vector< std::pair< Position< D >, index > > positions;
 
@@ -399,8 +699,8 @@ ConnectionCreator::fixed_indegree_( Layer< D >& source,
       const std::vector< double > target_pos_vector = target_pos.get_vector();
 
       // Get (position,node ID) pairs for sources inside mask
-      positions.resize( std::distance( masked_source.begin( target_pos ), masked_source_end ) );
-      std::copy( masked_source.begin( target_pos ), masked_source_end, positions.begin() );
+      positions.clear();
+      pool.get_masked_nodes( target_pos, positions );
 
       // We will select `number_of_connections_` sources within the mask.
       // If there is no kernel, we can just draw uniform random numbers,
@@ -635,6 +935,181 @@ ConnectionCreator::fixed_indegree_( Layer< D >& source,
 }
 
 
+template < int D >
+void
+ConnectionCreator::fixed_indegree_alias_( Layer< D >& source,
+  NodeCollectionPTR source_nc,
+  Layer< D >& target,
+  NodeCollectionPTR target_nc )
+{
+  // fixed_indegree connections drawn from alias tables
+  //
+  // For each local target node, on the thread of the target:
+  // 1. Apply Mask to source layer
+  // 2. Compute connection probability for each source position and build
+  //    an alias table
+  // 3. Draw source nodes and make connections
+  //
+  // For grid source layers with periodic boundary conditions, steps 1 and
+  // 2 are done before connecting, once for all targets at the same position
+  // relative to the grid, see GridAliasTables_.
+
+  PoolWrapper_< D > pool;
+  if ( mask_.get() and partition_positions_ )
+  {
+    // Only fetch positions of sources which may be inside the mask of a local target
+    const Box< D > local_region = get_local_region_( target, target_nc );
+    pool.define(
+      new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc, &local_region ), use_cell_list_, true );
+  }
+  else if ( mask_.get() ) // MaskedLayer will be freed by PoolWrapper d'tor
+  {
+    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc ), use_cell_list_ );
+  }
+  else
+  {
+    pool.define( source.get_global_positions_vector( source_nc ) );
+  }
+
+  std::unique_ptr< GridAliasTables_< D > > grid_tables;
+  if ( GridAliasTables_< D >::is_applicable( source, source_nc ) )
+  {
+    grid_tables.reset( new GridAliasTables_< D >( dynamic_cast< GridLayer< D >& >( source ), source_nc ) );
+
+    std::vector< std::pair< Position< D >, index > > positions;
+    std::vector< double > probabilities;
+    Position< D, int > base;
+
+    for ( NodeCollection::const_iterator tgt_it = target_nc->MPI_local_begin(); tgt_it < target_nc->end(); ++tgt_it )
+    {
+      const Position< D > target_pos = target.get_position( ( *tgt_it ).lid );
+      if ( grid_tables->find( target_pos, base ) )
+      {
+        continue;
+      }
+
+      Node* const tgt = kernel().node_manager.get_node_or_proxy( ( *tgt_it ).node_id );
+      get_sources_( pool, source, target_pos, tgt, get_vp_specific_rng( tgt->get_thread() ), positions, probabilities );
+      grid_tables->insert( target_pos, positions, probabilities );
+    }
+  }
+
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_( kernel().vp_manager.get_num_threads() );
+
+#pragma omp parallel
+  {
+    const thread thread_id = kernel().vp_manager.get_thread_id();
+    try
+    {
+      RngPtr rng = get_vp_specific_rng( thread_id );
+
+      // We create these vectors here that can be updated for each target.
+      // This is done to avoid creating and destroying unnecessarily many vectors.
+      std::vector< std::pair< Position< D >, index > > positions;
+      std::vector< double > probabilities;
+      std::vector< double > source_pos_vector( D );
+      AliasTable lottery;
+      std::pair< Position< D >, index > source_node;
+      Position< D, int > base;
+
+      NodeCollection::const_iterator target_begin = target_nc->local_begin();
+      NodeCollection::const_iterator target_end = target_nc->end();
+
+      for ( NodeCollection::const_iterator tgt_it = target_begin; tgt_it < target_end; ++tgt_it )
+      {
+        const index target_id = ( *tgt_it ).node_id;
+        Node* const tgt = kernel().node_manager.get_node_or_proxy( target_id, thread_id );
+
+        assert( not tgt->is_proxy() );
+
+        const Position< D > target_pos = target.get_position( ( *tgt_it ).lid );
+        const std::vector< double > target_pos_vector = target_pos.get_vector();
+
+        const typename GridAliasTables_< D >::Entry* entry =
+          grid_tables ? grid_tables->find( target_pos, base ) : nullptr;
+        size_t num_sources;
+        if ( entry )
+        {
+          num_sources = entry->table.size();
+          if ( not allow_autapses_ and num_sources == 1 )
+          {
+            grid_tables->get_node( *entry, base, 0, source_node );
+            if ( source_node.second == target_id )
+            {
+              std::string msg =
+                String::compose( "Global target ID %1: Not enough sources found inside mask", target_id );
+              throw KernelException( msg.c_str() );
+            }
+          }
+        }
+        else
+        {
+          get_sources_( pool, source, target_pos, tgt, rng, positions, probabilities );
+          lottery.build( probabilities );
+          num_sources = positions.size();
+        }
+
+        // If multapses are not allowed, we must keep track of which
+        // sources have been selected already.
+        std::vector< bool > is_selected( num_sources );
+
+        // Draw `number_of_connections_` sources
+        for ( int i = 0; i < ( int ) number_of_connections_; ++i )
+        {
+          index random_id;
+          if ( entry )
+          {
+            random_id = grid_tables->draw( *entry, base, rng, source_node );
+          }
+          else
+          {
+            random_id = lottery( rng );
+            source_node = positions[ random_id ];
+          }
+
+          if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
+          {
+            --i;
+            continue;
+          }
+
+          const index source_id = source_node.second;
+          if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
+          {
+            --i;
+            continue;
+          }
+
+          source_node.first.get_vector( source_pos_vector );
+          for ( size_t indx = 0; indx < synapse_model_.size(); ++indx )
+          {
+            const double w = weight_[ indx ]->value( rng, source_pos_vector, target_pos_vector, source, tgt );
+            const double d = delay_[ indx ]->value( rng, source_pos_vector, target_pos_vector, source, tgt );
+            kernel().connection_manager.connect(
+              source_id, tgt, thread_id, synapse_model_[ indx ], param_dicts_[ indx ][ thread_id ], d, w );
+          }
+
+          is_selected[ random_id ] = true;
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised_.at( thread_id ) =
+        std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  } // omp parallel
+  // check if any exceptions have been raised
+  for ( thread thr = 0; thr < kernel().vp_manager.get_num_threads(); ++thr )
+  {
+    if ( exceptions_raised_.at( thr ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised_.at( thr ) ) );
+    }
+  }
+}
+
 template < int D >
 void
 ConnectionCreator::fixed_outdegree_( Layer< D >& source,
@@ -676,7 +1151,10 @@ ConnectionCreator::fixed_outdegree_( Layer< D >& source,
   // 3. Draw connections to make using global rng
 
   MaskedLayer< D > masked_target( target, mask_, allow_oversized_, target_nc );
-  const auto masked_target_end = masked_target.end();
+  if ( use_cell_list_ )
+  {
+    masked_target.build_cell_list();
+  }
 
   // We create a target positions vector here that can be updated with the
   // position and node ID pairs. This is done to avoid creating and destroying
@@ -685,6 +1163,17 @@ ConnectionCreator::fixed_outdegree_( Layer< D >& source,
   std::vector< std::pair< Position< D >, index > > source_pos_node_id_pairs =
     *source.get_global_positions_vector( source_nc );
 
+  // With alias sampling, targets in grid layers with periodic boundary
+  // conditions are drawn from tables shared by all sources at the same
+  // position relative to the grid, see GridAliasTables_.
+  std::unique_ptr< GridAliasTables_< D > > grid_tables;
+  if ( alias_sampling_ and GridAliasTables_< D >::is_applicable( target, target_nc ) )
+  {
+    grid_tables.reset( new GridAliasTables_< D >( dynamic_cast< GridLayer< D >& >( target ), target_nc ) );
+  }
+  std::pair< Position< D >, index > target_node;
+  Position< D, int > base;
+
   for ( const auto& source_pos_node_id_pair : source_pos_node_id_pairs )
   {
     const Position< D > source_pos = source_pos_node_id_pair.first;
@@ -697,54 +1186,82 @@ ConnectionCreator::fixed_outdegree_( Layer< D >& source,
     std::vector< double > target_pos_vector( D );
     std::vector< double > probabilities;
 
-    // Find potential targets and probabilities
     RngPtr grng = get_rank_synced_rng();
-    target_pos_node_id_pairs.resize( std::distance( masked_target.begin( source_pos ), masked_target_end ) );
-    std::copy( masked_target.begin( source_pos ), masked_target_end, target_pos_node_id_pairs.begin() );
 
-    probabilities.reserve( target_pos_node_id_pairs.size() );
-    if ( kernel_.get() )
+    // Draw targets.  A discrete_distribution draws random integers with a
+    // non-uniform distribution, an AliasTable does the same in constant time.
+    discrete_distribution lottery;
+    AliasTable alias_lottery;
+
+    const typename GridAliasTables_< D >::Entry* entry = grid_tables ? grid_tables->find( source_pos, base ) : nullptr;
+    if ( entry == nullptr )
     {
-      for ( const auto& target_pos_node_id_pair : target_pos_node_id_pairs )
+      // Find potential targets and probabilities
+      target_pos_node_id_pairs.clear();
+      masked_target.get_nodes( source_pos, target_pos_node_id_pairs );
+
+      probabilities.reserve( target_pos_node_id_pairs.size() );
+      if ( kernel_.get() )
       {
-        // TODO: Why is probability calculated in source layer, but weight and delay in target layer?
-        target_pos_node_id_pair.first.get_vector( target_pos_vector );
-        const auto tgt = kernel().node_manager.get_node_or_proxy( target_pos_node_id_pair.second );
-        probabilities.push_back( kernel_->value( grng, source_pos_vector, target_pos_vector, source, tgt ) );
+        for ( const auto& target_pos_node_id_pair : target_pos_node_id_pairs )
+        {
+          // TODO: Why is probability calculated in source layer, but weight and delay in target layer?
+          target_pos_node_id_pair.first.get_vector( target_pos_vector );
+          const auto tgt = kernel().node_manager.get_node_or_proxy( target_pos_node_id_pair.second );
+          probabilities.push_back( kernel_->value( grng, source_pos_vector, target_pos_vector, source, tgt ) );
+        }
+      }
+      else
+      {
+        probabilities.resize( target_pos_node_id_pairs.size(), 1.0 );
       }
-    }
-    else
-    {
-      probabilities.resize( target_pos_node_id_pairs.size(), 1.0 );
-    }
 
-    if ( target_pos_node_id_pairs.empty()
-      or ( ( not allow_multapses_ ) and ( target_pos_node_id_pairs.size() < number_of_connections_ ) ) )
-    {
-      std::string msg = String::compose( "Global source ID %1: Not enough targets found", source_id );
-      throw KernelException( msg.c_str() );
-    }
+      if ( target_pos_node_id_pairs.empty()
+        or ( ( not allow_multapses_ ) and ( target_pos_node_id_pairs.size() < number_of_connections_ ) )
+        or ( alias_sampling_ and std::accumulate( probabilities.begin(), probabilities.end(), 0.0 ) <= 0.0 ) )
+      {
+        std::string msg = String::compose( "Global source ID %1: Not enough targets found", source_id );
+        throw KernelException( msg.c_str() );
+      }
 
-    // Draw targets.  A discrete_distribution draws random integers with a
-    // non-uniform distribution.
-    discrete_distribution lottery;
-    const discrete_distribution::param_type param( probabilities.begin(), probabilities.end() );
-    lottery.param( param );
+      if ( grid_tables )
+      {
+        entry = &grid_tables->insert( source_pos, target_pos_node_id_pairs, probabilities );
+      }
+      else if ( alias_sampling_ )
+      {
+        alias_lottery.build( probabilities );
+      }
+      else
+      {
+        const discrete_distribution::param_type param( probabilities.begin(), probabilities.end() );
+        lottery.param( param );
+      }
+    }
 
     // If multapses are not allowed, we must keep track of which
     // targets have been selected already.
-    std::vector< bool > is_selected( target_pos_node_id_pairs.size() );
+    std::vector< bool > is_selected( entry ? entry->table.size() : target_pos_node_id_pairs.size() );
 
     // Draw `number_of_connections_` targets
     for ( long i = 0; i < ( long ) number_of_connections_; ++i )
     {
-      index random_id = lottery( get_rank_synced_rng() );
+      index random_id;
+      if ( entry )
+      {
+        random_id = grid_tables->draw( *entry, base, grng, target_node );
+      }
+      else
+      {
+        random_id = alias_sampling_ ? alias_lottery( grng ) : lottery( grng );
+        target_node = target_pos_node_id_pairs[ random_id ];
+      }
       if ( ( not allow_multapses_ ) and ( is_selected[ random_id ] ) )
       {
         --i;
         continue;
       }
-      index target_id = target_pos_node_id_pairs[ random_id ].second;
+      index target_id = target_node.second;
       if ( ( not allow_autapses_ ) and ( source_id == target_id ) )
       {
         --i;
@@ -753,13 +1270,13 @@ ConnectionCreator::fixed_outdegree_( Layer< D >& source,
 
       is_selected[ random_id ] = true;
 
-      target_pos_node_id_pairs[ random_id ].first.get_vector( target_pos_vector );
+      target_node.first.get_vector( target_pos_vector );
 
       std::vector< double > rng_weight_vec;
       std::vector< double > rng_delay_vec;
       for ( size_t indx = 0; indx < weight_.size(); ++indx )
       {
-        const auto tgt = kernel().node_manager.get_node_or_proxy( target_pos_node_id_pairs[ indx ].second );
+        const auto tgt = kernel().node_manager.get_node_or_proxy( target_id );
         rng_weight_vec.push_back( weight_[ indx ]->value( grng, source_pos_vector, target_pos_vector, target, tgt ) );
         rng_delay_vec.push_back( delay_[ indx ]->value( grng, source_pos_vector, target_pos_vector, target, tgt ) );
       }
@@ -75,6 +75,8 @@ nest::ConnectionManager::ConnectionManager()
   , secondary_connections_exist_( false )
   , check_secondary_connections_()
   , stdp_eps_( 1.0e-6 )
+  , stdp_trace_cache_( false )
+  , stdp_fast_exp_( false )
 {
 }
 
@@ -176,6 +178,9 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
     throw KernelException( "Spike compression requires sort_connections_by_source to be true." );
   }
 
+  updateValue< bool >( d, names::stdp_trace_cache, stdp_trace_cache_ );
+  updateValue< bool >( d, names::stdp_fast_exp, stdp_fast_exp_ );
+
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
   {
@@ -201,6 +206,8 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
   def< bool >( dict, names::sort_connections_by_source, sort_connections_by_source_ );
   def< bool >( dict, names::use_compressed_spikes, use_compressed_spikes_ );
+  def< bool >( dict, names::stdp_trace_cache, stdp_trace_cache_ );
+  def< bool >( dict, names::stdp_fast_exp, stdp_fast_exp_ );
 
   def< double >( dict, names::time_construction_connect, sw_construction_connect.elapsed() );
 
@@ -875,17 +882,39 @@ nest::ConnectionManager::trigger_update_weight( const long vt_id,
 {
   const thread tid = kernel().vp_manager.get_thread_id();
 
-  for ( std::vector< ConnectorBase* >::iterator it = connections_[ tid ].begin(); it != connections_[ tid ].end();
-        ++it )
+  const std::map< long, std::vector< synindex > >::const_iterator syn_ids = syn_ids_of_vt_.find( vt_id );
+  if ( syn_ids == syn_ids_of_vt_.end() )
+  {
+    return;
+  }
+
+  for ( const synindex syn_id : syn_ids->second )
   {
-    if ( *it != NULL )
+    if ( syn_id < connections_[ tid ].size() and connections_[ tid ][ syn_id ] != NULL )
     {
-      ( *it )->trigger_update_weight(
+      connections_[ tid ][ syn_id ]->trigger_update_weight(
         vt_id, tid, dopa_spikes, t_trig, kernel().model_manager.get_connection_models( tid ) );
     }
   }
 }
 
+void
+nest::ConnectionManager::prepare()
+{
+  // The volume transmitter is a common property of a synapse model and thus
+  // the same on all threads.
+  syn_ids_of_vt_.clear();
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_connection_models( 0 );
+  for ( synindex syn_id = 0; syn_id < cm.size(); ++syn_id )
+  {
+    const long vt_node_id = cm[ syn_id ]->get_vt_node_id();
+    if ( vt_node_id >= 0 )
+    {
+      syn_ids_of_vt_[ vt_node_id ].push_back( syn_id );
+    }
+  }
+}
+
 size_t
 nest::ConnectionManager::get_num_target_data( const thread tid ) const
 {
@@ -1564,6 +1593,91 @@ nest::ConnectionManager::remove_disabled_connections( const thread tid )
   }
 }
 
+void
+nest::ConnectionManager::dump_connections( const thread tid,
+  const synindex syn_id,
+  std::vector< index >& source_node_ids,
+  std::vector< index >& target_node_ids,
+  std::vector< char >& data ) const
+{
+  const ConnectorBase* connector = connections_[ tid ][ syn_id ];
+  if ( connector == NULL )
+  {
+    return;
+  }
+
+  if ( source_table_.is_cleared() )
+  {
+    throw KernelException(
+      "Network snapshots require the source table. Set keep_source_table to true before creating connections." );
+  }
+
+  std::vector< index > lcids;
+  connector->dump_connections( tid, lcids, target_node_ids, data );
+
+  source_node_ids.reserve( source_node_ids.size() + lcids.size() );
+  for ( auto lcid : lcids )
+  {
+    source_node_ids.push_back( source_table_.get_node_id( tid, syn_id, lcid ) );
+  }
+}
+
+void
+nest::ConnectionManager::restore_connections( const thread tid,
+  const synindex syn_id,
+  const index* source_node_ids,
+  const index* target_node_ids,
+  const char* data,
+  const size_t conn_size,
+  const size_t n )
+{
+  if ( n == 0 )
+  {
+    return;
+  }
+
+  ConnectorModel& cm = kernel().model_manager.get_connection_model( syn_id, tid );
+  cm.restore_connections( connections_[ tid ], syn_id, tid, data, conn_size, target_node_ids, n );
+
+  const bool is_primary = cm.is_primary();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    source_table_.add_source( tid, syn_id, source_node_ids[ i ], is_primary );
+  }
+
+  if ( num_connections_[ tid ].size() <= syn_id )
+  {
+    num_connections_[ tid ].resize( syn_id + 1 );
+  }
+  num_connections_[ tid ][ syn_id ] += n;
+  if ( num_connections_[ tid ][ syn_id ] >= MAX_LCID )
+  {
+    throw KernelException(
+      String::compose( "Too many connections: at most %1 connections supported per virtual "
+                       "process and synapse model.",
+        MAX_LCID ) );
+  }
+
+  if ( is_primary )
+  {
+#pragma omp atomic write
+    has_primary_connections_ = true;
+    check_primary_connections_[ tid ].set_true();
+  }
+  else
+  {
+#pragma omp atomic write
+    secondary_connections_exist_ = true;
+    check_secondary_connections_[ tid ].set_true();
+  }
+}
+
+bool
+nest::ConnectionManager::has_device_connections() const
+{
+  return target_table_devices_.has_connections();
+}
+
 void
 nest::ConnectionManager::resize_connections()
 {
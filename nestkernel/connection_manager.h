@@ -84,6 +84,12 @@ public:
   virtual void set_status( const DictionaryDatum& ) override;
   virtual void get_status( DictionaryDatum& ) override;
 
+  /**
+   * Index the synapse models controlled by each volume transmitter, see
+   * trigger_update_weight().
+   */
+  virtual void prepare() override;
+
   bool valid_connection_rule( std::string );
 
   void compute_target_data_buffer_size();
@@ -235,6 +241,8 @@ public:
    * Triggered by volume transmitter in update.
    * Triggeres updates for all connectors of dopamine synapses that
    * are registered with the volume transmitter with node_id vt_node_id.
+   * Only the connectors of the synapse models indexed for the volume
+   * transmitter by prepare() are visited.
    */
   void
   trigger_update_weight( const long vt_node_id, const std::vector< spikecounter >& dopa_spikes, const double t_trig );
@@ -341,6 +349,34 @@ public:
    */
   void remove_disabled_connections( const thread tid );
 
+  /**
+   * Collects the source and target node IDs and the raw contents of all
+   * connections of the given synapse type on thread tid, for writing a
+   * network snapshot.
+   */
+  void dump_connections( const thread tid,
+    const synindex syn_id,
+    std::vector< index >& source_node_ids,
+    std::vector< index >& target_node_ids,
+    std::vector< char >& data ) const;
+
+  /**
+   * Restores n connections of the given synapse type on thread tid from
+   * a network snapshot. All targets must be local to thread tid.
+   */
+  void restore_connections( const thread tid,
+    const synindex syn_id,
+    const index* source_node_ids,
+    const index* target_node_ids,
+    const char* data,
+    const size_t conn_size,
+    const size_t n );
+
+  /**
+   * Returns true if there are connections to or from devices on this rank.
+   */
+  bool has_device_connections() const;
+
   /**
    * Returns true if connection information needs to be
    * communicated. False otherwise.
@@ -403,6 +439,16 @@ public:
 
   void set_stdp_eps( const double stdp_eps );
 
+  //! Whether archiving nodes cache the Kminus values requested by STDP synapses
+  bool use_stdp_trace_cache() const;
+
+  /**
+   * Whether plasticity rules use numerics::fast_exp() for trace decays.
+   *
+   * Synapses read this once per spike and pass it to numerics::select_exp().
+   */
+  bool use_stdp_fast_exp() const;
+
   // public stop watch for benchmarking purposes
   // start and stop in high-level connect functions in nestmodule.cpp and nest.cpp
   Stopwatch sw_construction_connect;
@@ -567,6 +613,9 @@ private:
 
   std::map< index, size_t > buffer_pos_of_source_node_id_syn_id_;
 
+  //! Synapse models controlled by each volume transmitter, by node ID of the volume transmitter
+  std::map< long, std::vector< synindex > > syn_ids_of_vt_;
+
   /**
    * A structure to hold the information about targets for each
    * neuron on the presynaptic side. Internally arranged in a 3d
@@ -629,6 +678,12 @@ private:
   //! Maximum distance between (double) spike times in STDP that is
   //! still considered 0. See issue #894
   double stdp_eps_;
+
+  //! Whether archiving nodes cache the Kminus values requested by STDP synapses
+  bool stdp_trace_cache_;
+
+  //! Whether plasticity rules use numerics::fast_exp() for trace decays
+  bool stdp_fast_exp_;
 };
 
 inline bool
@@ -809,6 +864,18 @@ ConnectionManager::get_stdp_eps() const
   return stdp_eps_;
 }
 
+inline bool
+ConnectionManager::use_stdp_trace_cache() const
+{
+  return stdp_trace_cache_;
+}
+
+inline bool
+ConnectionManager::use_stdp_fast_exp() const
+{
+  return stdp_fast_exp_;
+}
+
 inline index
 ConnectionManager::get_target_node_id( const thread tid, const synindex syn_id, const index lcid ) const
 {
@@ -28,6 +28,7 @@
 
 // C++ includes:
 #include <cstdlib>
+#include <type_traits>
 #include <vector>
 
 // Includes from libnestutil:
@@ -207,6 +208,15 @@ public:
    * Remove disabled connections from the connector.
    */
   virtual void remove_disabled_connections( const index first_disabled_index ) = 0;
+
+  /**
+   * Append the lcids, the node IDs of the targets and the raw contents of
+   * all connections that are not disabled, for writing a network snapshot.
+   */
+  virtual void dump_connections( const thread tid,
+    std::vector< index >& lcids,
+    std::vector< index >& target_node_ids,
+    std::vector< char >& data ) const = 0;
 };
 
 /**
@@ -421,18 +431,18 @@ public:
     const double t_trig,
     const std::vector< ConnectorModel* >& cm )
   {
+    const typename ConnectionT::CommonPropertiesType& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    // the volume transmitter is a common property of all connections
+    if ( cp.get_vt_node_id() != vt_node_id )
+    {
+      return;
+    }
+
     for ( size_t i = 0; i < C_.size(); ++i )
     {
-      if ( static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )
-             ->get_common_properties()
-             .get_vt_node_id()
-        == vt_node_id )
-      {
-        C_[ i ].trigger_update_weight( tid,
-          dopa_spikes,
-          t_trig,
-          static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties() );
-      }
+      C_[ i ].trigger_update_weight( tid, dopa_spikes, t_trig, cp );
     }
   }
 
@@ -495,6 +505,30 @@ public:
     assert( C_[ first_disabled_index ].is_disabled() );
     C_.erase( C_.begin() + first_disabled_index, C_.end() );
   }
+
+  void
+  dump_connections( const thread tid,
+    std::vector< index >& lcids,
+    std::vector< index >& target_node_ids,
+    std::vector< char >& data ) const
+  {
+    // connections are written and restored as plain bytes
+    if ( not std::is_trivially_copyable< ConnectionT >::value )
+    {
+      throw NotImplemented( "This synapse model does not support network snapshots." );
+    }
+
+    for ( index lcid = 0; lcid < C_.size(); ++lcid )
+    {
+      if ( not C_[ lcid ].is_disabled() )
+      {
+        const char* raw = reinterpret_cast< const char* >( &C_[ lcid ] );
+        lcids.push_back( lcid );
+        target_node_ids.push_back( C_[ lcid ].get_target( tid )->get_node_id() );
+        data.insert( data.end(), raw, raw + sizeof( ConnectionT ) );
+      }
+    }
+  }
 };
 
 } // of namespace nest
@@ -39,25 +39,18 @@ Connector< ConnectionT >::send_weight_event( const thread tid,
   const CommonSynapseProperties& cp )
 {
   // If the pointer to the receiver node in the event is invalid,
-  // the event was not sent, and a WeightRecorderEvent is therefore not created.
+  // the event was not sent, and the weight is therefore not recorded.
   if ( cp.get_weight_recorder() and e.receiver_is_valid() )
   {
-    // Create new event to record the weight and copy relevant content.
-    WeightRecorderEvent wr_e;
-    wr_e.set_port( e.get_port() );
-    wr_e.set_rport( e.get_rport() );
-    wr_e.set_stamp( e.get_stamp() );
-    wr_e.set_sender( e.get_sender() );
-    wr_e.set_sender_node_id( kernel().connection_manager.get_source_node_id( tid, syn_id_, lcid ) );
-    wr_e.set_weight( e.get_weight() );
-    wr_e.set_delay_steps( e.get_delay_steps() );
-    // Set weight_recorder as receiver
-    index wr_node_id = cp.get_wr_node_id();
-    Node* wr_node = kernel().node_manager.get_node_or_proxy( wr_node_id, tid );
-    wr_e.set_receiver( *wr_node );
-    // Put the node_id of the postsynaptic node as receiver node ID
-    wr_e.set_receiver_node_id( e.get_receiver_node_id() );
-    wr_e();
+    // The weight_recorder on this thread buffers the values and writes
+    // them to its recording backend once per time slice.
+    Node* wr_node = kernel().node_manager.get_node_or_proxy( cp.get_wr_node_id(), tid );
+    wr_node->record_weight( kernel().connection_manager.get_source_node_id( tid, syn_id_, lcid ),
+      e.get_receiver_node_id(),
+      e.get_rport(),
+      e.get_port(),
+      e.get_stamp(),
+      e.get_weight() );
   }
 }
 
@@ -85,6 +85,26 @@ public:
     const double delay = NAN,
     const double weight = NAN ) = 0;
 
+  /**
+   * Restores connections from a network snapshot.
+   *
+   * @param thread_local_connectors Connector vector of thread tid
+   * @param syn_id Synapse id
+   * @param tid Thread of the targets
+   * @param data Raw contents of the connections as written by
+   *             ConnectorBase::dump_connections()
+   * @param conn_size Size of a single connection in data
+   * @param target_node_ids Node IDs of the targets
+   * @param n Number of connections
+   */
+  virtual void restore_connections( std::vector< ConnectorBase* >& thread_local_connectors,
+    const synindex syn_id,
+    const thread tid,
+    const char* data,
+    const size_t conn_size,
+    const index* target_node_ids,
+    const size_t n ) = 0;
+
   virtual ConnectorModel* clone( std::string ) const = 0;
 
   virtual void calibrate( const TimeConverter& tc ) = 0;
@@ -94,6 +114,12 @@ public:
 
   virtual const CommonSynapseProperties& get_common_properties() const = 0;
 
+  /**
+   * Return node ID of the volume transmitter controlling all connections of
+   * the model, or -1 if there is none.
+   */
+  virtual long get_vt_node_id() const = 0;
+
   /**
    * Checks to see if illegal parameters are given in syn_spec.
    */
@@ -215,6 +241,14 @@ public:
     const double delay,
     const double weight );
 
+  void restore_connections( std::vector< ConnectorBase* >& thread_local_connectors,
+    const synindex syn_id,
+    const thread tid,
+    const char* data,
+    const size_t conn_size,
+    const index* target_node_ids,
+    const size_t n );
+
   ConnectorModel* clone( std::string ) const;
 
   void calibrate( const TimeConverter& tc );
@@ -234,6 +268,12 @@ public:
     return cp_;
   }
 
+  long
+  get_vt_node_id() const
+  {
+    return cp_.get_vt_node_id();
+  }
+
   void set_syn_id( synindex syn_id );
 
   virtual typename ConnectionT::EventType*
@@ -28,6 +28,11 @@
 // Generated includes:
 #include "config.h"
 
+// C++ includes:
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 // Includes from libnestutil:
 #include "compose.hpp"
 
@@ -281,6 +286,56 @@ GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
   vc->push_back( connection );
 }
 
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::restore_connections( std::vector< ConnectorBase* >& thread_local_connectors,
+  const synindex syn_id,
+  const thread tid,
+  const char* data,
+  const size_t conn_size,
+  const index* target_node_ids,
+  const size_t n )
+{
+  assert( syn_id != invalid_synindex );
+
+  if ( conn_size != sizeof( ConnectionT ) )
+  {
+    throw KernelException(
+      String::compose( "The network snapshot contains connections of synapse model %1 of a different size. "
+                       "Snapshots can only be loaded by the NEST build that wrote them.",
+        name_ ) );
+  }
+
+  if ( thread_local_connectors[ syn_id ] == NULL )
+  {
+    thread_local_connectors[ syn_id ] = new Connector< ConnectionT >( syn_id );
+  }
+
+  Connector< ConnectionT >* vc = static_cast< Connector< ConnectionT >* >( thread_local_connectors[ syn_id ] );
+
+  long min_delay = std::numeric_limits< long >::max();
+  long max_delay = std::numeric_limits< long >::min();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    // The connections have been checked when they were created, so we only
+    // need to replace the target and the synapse id.
+    ConnectionT connection;
+    std::memcpy( static_cast< void* >( &connection ), data + i * conn_size, conn_size );
+    connection.set_target( kernel().node_manager.get_node_or_proxy( target_node_ids[ i ], tid ) );
+    connection.set_syn_id( syn_id );
+
+    min_delay = std::min( min_delay, connection.get_delay_steps() );
+    max_delay = std::max( max_delay, connection.get_delay_steps() );
+
+    vc->push_back( connection );
+  }
+
+  if ( has_delay_ and n > 0 )
+  {
+    kernel().connection_manager.get_delay_checker().assert_two_valid_delays_steps( min_delay, max_delay );
+  }
+}
+
 } // namespace nest
 
 #endif
@@ -61,9 +61,25 @@ protected:
   template < class Ins >
   void communicate_positions_( Ins iter, NodeCollectionPTR node_collection );
 
+  /**
+   * Communicate positions inside a region across MPI processes. Each MPI
+   * process only receives the positions of nodes inside its own region.
+   * @param iter Insert iterator which will receive pairs of Position,node ID
+   * @param node_collection NodeCollection of the layer
+   * @param region Region of positions required by this MPI process
+   * @param tree Ntree defining the periodic geometry for the region test
+   */
+  template < class Ins >
+  void communicate_region_positions_( Ins iter,
+    NodeCollectionPTR node_collection,
+    const Box< D >& region,
+    const Ntree< D, index >& tree );
+
   void insert_global_positions_ntree_( Ntree< D, index >& tree, NodeCollectionPTR node_collection );
   void insert_global_positions_vector_( std::vector< std::pair< Position< D >, index > >& vec,
     NodeCollectionPTR node_collection );
+  void
+  insert_region_positions_ntree_( Ntree< D, index >& tree, NodeCollectionPTR node_collection, const Box< D >& region );
 
   /**
    * Calculate the index in the position vector on this MPI process based on the local ID.
@@ -81,6 +97,19 @@ protected:
   class NodePositionData
   {
   public:
+    NodePositionData()
+    {
+    }
+
+    NodePositionData( index node_id, const Position< D >& pos )
+      : node_id_( node_id )
+    {
+      for ( int j = 0; j < D; ++j )
+      {
+        pos_[ j ] = pos[ j ];
+      }
+    }
+
     index
     get_node_id() const
     {
@@ -313,6 +342,71 @@ FreeLayer< D >::communicate_positions_( Ins iter, NodeCollectionPTR node_collect
   }
 }
 
+template < int D >
+template < class Ins >
+void
+FreeLayer< D >::communicate_region_positions_( Ins iter,
+  NodeCollectionPTR node_collection,
+  const Box< D >& region,
+  const Ntree< D, index >& tree )
+{
+  const int num_procs = kernel().mpi_manager.get_num_processes();
+
+  // Exchange the regions required by all MPI processes
+  std::vector< double > local_region( 2 * D );
+  for ( int j = 0; j < D; ++j )
+  {
+    local_region[ j ] = region.lower_left[ j ];
+    local_region[ D + j ] = region.upper_right[ j ];
+  }
+  std::vector< double > global_regions;
+  std::vector< int > displacements;
+  kernel().mpi_manager.communicate( local_region, global_regions, displacements );
+
+  // See communicate_positions_() for the choice of nodes to iterate.
+  NodeCollection::const_iterator nc_begin =
+    node_collection->has_proxies() ? node_collection->MPI_local_begin() : node_collection->begin();
+  NodeCollection::const_iterator nc_end = node_collection->end();
+
+  std::vector< std::pair< Position< D >, index > > local_positions;
+  local_positions.reserve( num_local_nodes_ );
+  for ( NodeCollection::const_iterator nc_it = nc_begin; nc_it < nc_end; ++nc_it )
+  {
+    local_positions.push_back(
+      std::pair< Position< D >, index >( get_position( ( *nc_it ).lid ), ( *nc_it ).node_id ) );
+  }
+
+  // Node ID,pos_x,pos_y[,pos_z] of local nodes inside the region of each MPI process, in rank order
+  std::vector< NodePositionData > send_buffer;
+  std::vector< int > send_counts( num_procs, 0 );
+  for ( int rank = 0; rank < num_procs; ++rank )
+  {
+    const double* r = &global_regions[ displacements[ rank ] ];
+    const Box< D > rank_region( Position< D >( r ), Position< D >( r + D ) );
+    for ( const auto& local_position : local_positions )
+    {
+      if ( this->is_in_region_( local_position.first, rank_region, tree ) )
+      {
+        send_buffer.push_back( NodePositionData( local_position.second, local_position.first ) );
+        ++send_counts[ rank ];
+      }
+    }
+  }
+
+  std::vector< NodePositionData > recv_buffer;
+  kernel().mpi_manager.communicate_Alltoallv( send_buffer, send_counts, recv_buffer );
+
+  // Get rid of any multiple entries
+  std::sort( recv_buffer.begin(), recv_buffer.end() );
+  const auto recv_end = std::unique( recv_buffer.begin(), recv_buffer.end() );
+
+  // Unpack node IDs and coordinates
+  for ( auto pos_it = recv_buffer.begin(); pos_it < recv_end; ++pos_it )
+  {
+    *iter++ = std::pair< Position< D >, index >( pos_it->get_position(), pos_it->get_node_id() );
+  }
+}
+
 template < int D >
 void
 FreeLayer< D >::insert_global_positions_ntree_( Ntree< D, index >& tree, NodeCollectionPTR node_collection )
@@ -321,6 +415,15 @@ FreeLayer< D >::insert_global_positions_ntree_( Ntree< D, index >& tree, NodeCol
   communicate_positions_( std::inserter( tree, tree.end() ), node_collection );
 }
 
+template < int D >
+void
+FreeLayer< D >::insert_region_positions_ntree_( Ntree< D, index >& tree,
+  NodeCollectionPTR node_collection,
+  const Box< D >& region )
+{
+  communicate_region_positions_( std::inserter( tree, tree.end() ), node_collection, region, tree );
+}
+
 // Helper function to compare node IDs used for sorting (Position,node ID) pairs
 template < int D >
 static bool
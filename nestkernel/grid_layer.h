@@ -156,6 +156,8 @@ protected:
   void insert_global_positions_ntree_( Ntree< D, index >& tree, NodeCollectionPTR node_collection );
   void insert_global_positions_vector_( std::vector< std::pair< Position< D >, index > >& vec,
     NodeCollectionPTR node_collection );
+  void
+  insert_region_positions_ntree_( Ntree< D, index >& tree, NodeCollectionPTR node_collection, const Box< D >& region );
 };
 
 template < int D >
@@ -302,6 +304,24 @@ GridLayer< D >::insert_global_positions_vector_( std::vector< std::pair< Positio
   insert_global_positions_( std::back_inserter( vec ), node_collection );
 }
 
+template < int D >
+void
+GridLayer< D >::insert_region_positions_ntree_( Ntree< D, index >& tree,
+  NodeCollectionPTR node_collection,
+  const Box< D >& region )
+{
+  // Grid positions are known on all MPI processes, so no communication is needed.
+  for ( auto gi = node_collection->begin(); gi < node_collection->end(); ++gi )
+  {
+    const auto triple = *gi;
+    const Position< D > pos = lid_to_position( triple.lid );
+    if ( this->is_in_region_( pos, region, tree ) )
+    {
+      tree.insert( pos, triple.node_id );
+    }
+  }
+}
+
 template < int D >
 inline typename GridLayer< D >::masked_iterator
 GridLayer< D >::masked_begin( const Mask< D >& mask, const Position< D >& anchor )
@@ -39,6 +39,36 @@
 // Includes from sli:
 #include "dictutils.h"
 
+void
+nest::GrowthCurve::compute_calcium_trace( double t,
+  double t_minus,
+  double Ca_minus,
+  double tau_Ca,
+  std::vector< double >& Ca_trace )
+{
+  const double h = Time::get_resolution().get_ms();
+
+  Ca_trace.clear();
+  double Ca = Ca_minus;
+  for ( double lag = t_minus; lag < ( t - h / 2.0 ); lag += h )
+  {
+    Ca = Ca - ( ( Ca / tau_Ca ) * h );
+    Ca_trace.push_back( Ca );
+  }
+}
+
+double
+nest::GrowthCurve::sum_growth( double z_minus, const std::vector< double >& dz )
+{
+  // Sum in the order of the steps, which a vectorized reduction would change
+  double z_value = z_minus;
+  for ( std::vector< double >::const_iterator it = dz.begin(); it != dz.end(); ++it )
+  {
+    z_value = z_value + *it;
+  }
+  return z_value;
+}
+
 /* ----------------------------------------------------------------
  * GrowthCurveLinear
  * ---------------------------------------------------------------- */
@@ -109,24 +139,52 @@ nest::GrowthCurveGaussian::update( double t,
   double z_minus,
   double tau_Ca,
   double growth_rate ) const
+{
+  std::vector< double > Ca_trace;
+  std::vector< double > dz;
+  compute_calcium_trace( t, t_minus, Ca_minus, tau_Ca, Ca_trace );
+  return update( t, t_minus, Ca_minus, z_minus, tau_Ca, growth_rate, Ca_trace, dz );
+}
+
+double
+nest::GrowthCurveGaussian::update( double,
+  double,
+  double,
+  double z_minus,
+  double,
+  double growth_rate,
+  const std::vector< double >& Ca_trace,
+  std::vector< double >& dz ) const
 {
   // Numerical integration from t_minus to t
   // use standard forward Euler numerics
-  const double h = Time::get_resolution().get_ms();
+  const double h_growth_rate = Time::get_resolution().get_ms() * growth_rate;
   const double zeta = ( eta_ - eps_ ) / ( 2.0 * sqrt( log( 2.0 ) ) );
   const double xi = ( eta_ + eps_ ) / 2.0;
 
-  double z_value = z_minus;
-  double Ca = Ca_minus;
+  const size_t n = Ca_trace.size();
+  dz.resize( n );
+  const double* const Ca = Ca_trace.data();
+  double* const d = dz.data();
 
-  for ( double lag = t_minus; lag < ( t - h / 2.0 ); lag += h )
+  // The calls of exp() are kept out of the other loops, which vectorize
+#pragma omp simd
+  for ( size_t k = 0; k < n; ++k )
   {
-    Ca = Ca - ( ( Ca / tau_Ca ) * h );
-    const double dz = h * growth_rate * ( 2.0 * exp( -pow( ( Ca - xi ) / zeta, 2 ) ) - 1.0 );
-    z_value = z_value + dz;
+    const double x = ( Ca[ k ] - xi ) / zeta;
+    d[ k ] = -( x * x );
+  }
+  for ( size_t k = 0; k < n; ++k )
+  {
+    d[ k ] = exp( d[ k ] );
+  }
+#pragma omp simd
+  for ( size_t k = 0; k < n; ++k )
+  {
+    d[ k ] = h_growth_rate * ( 2.0 * d[ k ] - 1.0 );
   }
 
-  return std::max( z_value, 0.0 );
+  return std::max( sum_growth( z_minus, dz ), 0.0 );
 }
 
 /* ----------------------------------------------------------------
@@ -168,20 +226,47 @@ nest::GrowthCurveSigmoid::update( double t,
   double z_minus,
   double tau_Ca,
   double growth_rate ) const
+{
+  std::vector< double > Ca_trace;
+  std::vector< double > dz;
+  compute_calcium_trace( t, t_minus, Ca_minus, tau_Ca, Ca_trace );
+  return update( t, t_minus, Ca_minus, z_minus, tau_Ca, growth_rate, Ca_trace, dz );
+}
+
+double
+nest::GrowthCurveSigmoid::update( double,
+  double,
+  double,
+  double z_minus,
+  double,
+  double growth_rate,
+  const std::vector< double >& Ca_trace,
+  std::vector< double >& dz ) const
 {
   // Numerical integration from t_minus to t
   // use standard forward Euler numerics
-  const double h = Time::get_resolution().get_ms();
+  const double h_growth_rate = Time::get_resolution().get_ms() * growth_rate;
 
-  double z_value = z_minus;
-  double Ca = Ca_minus;
+  const size_t n = Ca_trace.size();
+  dz.resize( n );
+  const double* const Ca = Ca_trace.data();
+  double* const d = dz.data();
 
-  for ( double lag = t_minus; lag < ( t - h / 2.0 ); lag += h )
+  // The calls of exp() are kept out of the other loops, which vectorize
+#pragma omp simd
+  for ( size_t k = 0; k < n; ++k )
   {
-    Ca = Ca - ( ( Ca / tau_Ca ) * h );
-    const double dz = h * growth_rate * ( ( 2.0 / ( 1.0 + exp( ( Ca - eps_ ) / psi_ ) ) ) - 1.0 );
-    z_value = z_value + dz;
+    d[ k ] = ( Ca[ k ] - eps_ ) / psi_;
+  }
+  for ( size_t k = 0; k < n; ++k )
+  {
+    d[ k ] = exp( d[ k ] );
+  }
+#pragma omp simd
+  for ( size_t k = 0; k < n; ++k )
+  {
+    d[ k ] = h_growth_rate * ( ( 2.0 / ( 1.0 + d[ k ] ) ) - 1.0 );
   }
 
-  return std::max( z_value, 0.0 );
+  return std::max( sum_growth( z_minus, dz ), 0.0 );
 }
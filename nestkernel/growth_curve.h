@@ -30,6 +30,9 @@
  * \date July 2013
  */
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "nest_types.h"
@@ -55,6 +58,47 @@ public:
   virtual void set( const DictionaryDatum& d ) = 0;
   virtual double
   update( double t, double t_minus, double Ca_minus, double z, double tau_Ca, double growth_rate ) const = 0;
+
+  /**
+   * Whether the curve is integrated step by step over the calcium
+   * concentration. Such curves take the concentration from a trace that
+   * is computed once for all synaptic elements of a neuron.
+   */
+  virtual bool
+  uses_calcium_trace() const
+  {
+    return false;
+  }
+
+  /**
+   * Same as update(), with the calcium concentration after each step from
+   * t_minus to t given in Ca_trace, as computed by compute_calcium_trace().
+   * The change of z in each step is computed into dz, which is resized as
+   * needed, so that callers can reuse one buffer per thread.
+   * Curves that do not use the trace ignore it. This is a separate overload
+   * rather than a new signature of update(), so that growth curves of
+   * extension modules, which only implement update(), keep working.
+   */
+  virtual double
+  update( double t,
+    double t_minus,
+    double Ca_minus,
+    double z,
+    double tau_Ca,
+    double growth_rate,
+    const std::vector< double >&,
+    std::vector< double >& ) const
+  {
+    return update( t, t_minus, Ca_minus, z, tau_Ca, growth_rate );
+  }
+
+  /**
+   * Compute the calcium concentration after each step from t_minus to t,
+   * decaying with time constant tau_Ca by the forward Euler method.
+   */
+  static void
+  compute_calcium_trace( double t, double t_minus, double Ca_minus, double tau_Ca, std::vector< double >& Ca_trace );
+
   virtual bool
   is( Name n )
   {
@@ -71,6 +115,12 @@ protected:
     : name_( name )
   {
   }
+
+  /**
+   * Return z_minus plus the changes in dz, added in order.
+   */
+  static double sum_growth( double z_minus, const std::vector< double >& dz );
+
   const Name name_;
 };
 
@@ -221,6 +271,20 @@ public:
   void get( DictionaryDatum& d ) const;
   void set( const DictionaryDatum& d );
   double update( double t, double t_minus, double Ca_minus, double z, double tau_Ca, double growth_rate ) const;
+  double update( double t,
+    double t_minus,
+    double Ca_minus,
+    double z,
+    double tau_Ca,
+    double growth_rate,
+    const std::vector< double >& Ca_trace,
+    std::vector< double >& dz ) const;
+
+  bool
+  uses_calcium_trace() const
+  {
+    return true;
+  }
 
 private:
   double eta_;
@@ -293,6 +357,20 @@ public:
   void get( DictionaryDatum& d ) const;
   void set( const DictionaryDatum& d );
   double update( double t, double t_minus, double Ca_minus, double z, double tau_Ca, double growth_rate ) const;
+  double update( double t,
+    double t_minus,
+    double Ca_minus,
+    double z,
+    double tau_Ca,
+    double growth_rate,
+    const std::vector< double >& Ca_trace,
+    std::vector< double >& dz ) const;
+
+  bool
+  uses_calcium_trace() const
+  {
+    return true;
+  }
 
 private:
   double eps_;
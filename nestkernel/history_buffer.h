@@ -0,0 +1,167 @@
+/*
+ *  history_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HISTORY_BUFFER_H
+#define HISTORY_BUFFER_H
+
+// C++ includes:
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Spike or plasticity history kept in contiguous memory.
+ *
+ * Entries are appended at the back and removed from the front, as a sliding
+ * window over a vector. Removing an entry only advances the offset of the
+ * first entry. Once more than half of the vector lies before the window, the
+ * remaining entries are moved to the front of the vector, so that removal
+ * takes amortized constant time and the memory is reused instead of growing
+ * with the number of spikes.
+ *
+ * Iterators are plain pointers. As for std::deque, appending an entry
+ * invalidates all iterators.
+ */
+template < typename EntryT >
+class HistoryBuffer
+{
+public:
+  typedef EntryT* iterator;
+  typedef const EntryT* const_iterator;
+
+  HistoryBuffer()
+    : first_( 0 )
+  {
+  }
+
+  iterator
+  begin()
+  {
+    return entries_.data() + first_;
+  }
+
+  iterator
+  end()
+  {
+    return entries_.data() + entries_.size();
+  }
+
+  const_iterator
+  begin() const
+  {
+    return entries_.data() + first_;
+  }
+
+  const_iterator
+  end() const
+  {
+    return entries_.data() + entries_.size();
+  }
+
+  size_t
+  size() const
+  {
+    return entries_.size() - first_;
+  }
+
+  bool
+  empty() const
+  {
+    return first_ == entries_.size();
+  }
+
+  EntryT&
+  operator[]( const size_t i )
+  {
+    assert( i < size() );
+    return entries_[ first_ + i ];
+  }
+
+  const EntryT&
+  operator[]( const size_t i ) const
+  {
+    assert( i < size() );
+    return entries_[ first_ + i ];
+  }
+
+  EntryT&
+  front()
+  {
+    assert( not empty() );
+    return entries_[ first_ ];
+  }
+
+  EntryT&
+  back()
+  {
+    assert( not empty() );
+    return entries_.back();
+  }
+
+  void
+  push_back( const EntryT& entry )
+  {
+    entries_.push_back( entry );
+  }
+
+  void
+  pop_front()
+  {
+    pop_front( 1 );
+  }
+
+  //! Remove the first n entries at once
+  void
+  pop_front( const size_t n )
+  {
+    assert( n <= size() );
+    first_ += n;
+    if ( first_ == entries_.size() )
+    {
+      clear();
+    }
+    else if ( 2 * first_ > entries_.size() )
+    {
+      entries_.erase( entries_.begin(), entries_.begin() + first_ );
+      first_ = 0;
+    }
+  }
+
+  //! Remove all entries, keeping the memory
+  void
+  clear()
+  {
+    entries_.clear();
+    first_ = 0;
+  }
+
+private:
+  std::vector< EntryT > entries_;
+  size_t first_; //!< Index of the first entry in entries_
+};
+
+} // namespace nest
+
+#endif /* #ifndef HISTORY_BUFFER_H */
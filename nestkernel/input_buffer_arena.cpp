@@ -0,0 +1,321 @@
+/*
+ *  input_buffer_arena.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "input_buffer_arena.h"
+
+// C++ includes:
+#include <algorithm>
+
+// Includes from nestkernel:
+#include "exceptions.h"
+#include "kernel_manager.h"
+
+namespace nest
+{
+
+static size_t
+num_buffer_slots()
+{
+  return kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay();
+}
+
+InputBufferStorage::InputBufferStorage( const size_t num_channels )
+  : num_channels_( num_channels )
+  , num_slots_( num_buffer_slots() )
+  , slot_stride_( num_channels )
+  , data_( nullptr )
+  , own_values_( num_slots_ * num_channels, 0.0 )
+  , arena_( nullptr )
+  , entry_( 0 )
+{
+  data_ = own_values_.data();
+}
+
+InputBufferStorage::InputBufferStorage( const InputBufferStorage& other )
+  : num_channels_( other.num_channels_ )
+  , num_slots_( 0 )
+  , slot_stride_( other.num_channels_ )
+  , data_( nullptr )
+  , own_values_()
+  , arena_( nullptr )
+  , entry_( 0 )
+{
+  assign_values_( other );
+}
+
+InputBufferStorage::InputBufferStorage( InputBufferStorage&& other ) noexcept
+  : num_channels_( other.num_channels_ )
+  , num_slots_( other.num_slots_ )
+  , slot_stride_( other.slot_stride_ )
+  , data_( other.data_ )
+  , own_values_( std::move( other.own_values_ ) )
+  , arena_( other.arena_ )
+  , entry_( other.entry_ )
+{
+  if ( arena_ )
+  {
+    arena_->rebind_( entry_, this );
+  }
+  other.num_slots_ = 0;
+  other.data_ = nullptr;
+  other.arena_ = nullptr;
+}
+
+InputBufferStorage::~InputBufferStorage()
+{
+  release_();
+}
+
+InputBufferStorage&
+InputBufferStorage::operator=( const InputBufferStorage& other )
+{
+  if ( this != &other )
+  {
+    release_();
+    num_channels_ = other.num_channels_;
+    slot_stride_ = num_channels_;
+    assign_values_( other );
+  }
+  return *this;
+}
+
+InputBufferStorage&
+InputBufferStorage::operator=( InputBufferStorage&& other ) noexcept
+{
+  if ( this != &other )
+  {
+    release_();
+    num_channels_ = other.num_channels_;
+    num_slots_ = other.num_slots_;
+    slot_stride_ = other.slot_stride_;
+    data_ = other.data_;
+    own_values_ = std::move( other.own_values_ );
+    arena_ = other.arena_;
+    entry_ = other.entry_;
+    if ( arena_ )
+    {
+      arena_->rebind_( entry_, this );
+    }
+    other.num_slots_ = 0;
+    other.data_ = nullptr;
+    other.arena_ = nullptr;
+  }
+  return *this;
+}
+
+void
+InputBufferStorage::assign_values_( const InputBufferStorage& other )
+{
+  num_slots_ = other.num_slots_;
+  own_values_.resize( num_slots_ * num_channels_ );
+  for ( size_t slot = 0; slot < num_slots_; ++slot )
+  {
+    std::copy( other.values( slot ), other.values( slot ) + num_channels_, &own_values_[ slot * num_channels_ ] );
+  }
+  data_ = own_values_.data();
+}
+
+void
+InputBufferStorage::release_()
+{
+  if ( arena_ )
+  {
+    arena_->release_( entry_ );
+    arena_ = nullptr;
+  }
+}
+
+void
+InputBufferStorage::resize()
+{
+  const size_t num_slots = num_buffer_slots();
+  if ( arena_ or num_slots == num_slots_ )
+  {
+    return;
+  }
+
+  own_values_.resize( num_slots * num_channels_, 0.0 );
+  num_slots_ = num_slots;
+  data_ = own_values_.data();
+}
+
+void
+InputBufferStorage::clear()
+{
+  resize();
+
+  if ( not arena_ )
+  {
+    InputBufferArena* arena = kernel().node_manager.get_input_buffer_arena();
+    if ( arena )
+    {
+      arena->add_( this );
+    }
+  }
+
+  for ( size_t slot = 0; slot < num_slots_; ++slot )
+  {
+    std::fill_n( data_ + slot * slot_stride_, num_channels_, 0.0 );
+  }
+}
+
+InputBufferArena::InputBufferArena()
+  : layout_( Layout::INDIVIDUAL )
+  , open_( false )
+  , changed_( false )
+  , num_slots_( 0 )
+  , num_released_( 0 )
+  , values_()
+  , buffers_()
+{
+}
+
+void
+InputBufferArena::open( const Layout layout )
+{
+  assert( layout != Layout::INDIVIDUAL );
+  changed_ = changed_ or layout != layout_;
+  layout_ = layout;
+  open_ = true;
+}
+
+void
+InputBufferArena::add_( InputBufferStorage* storage )
+{
+  assert( open_ );
+  storage->arena_ = this;
+  storage->entry_ = buffers_.size();
+  buffers_.push_back( storage );
+  changed_ = true;
+}
+
+void
+InputBufferArena::release_( const size_t entry )
+{
+  assert( entry < buffers_.size() );
+  buffers_[ entry ] = nullptr;
+  ++num_released_;
+  changed_ = true;
+}
+
+void
+InputBufferArena::rebind_( const size_t entry, InputBufferStorage* storage )
+{
+  assert( entry < buffers_.size() );
+  buffers_[ entry ] = storage;
+}
+
+void
+InputBufferArena::close()
+{
+  open_ = false;
+
+  const size_t num_slots = num_buffer_slots();
+  if ( not changed_ and num_slots == num_slots_ )
+  {
+    return;
+  }
+
+  buffers_.erase( std::remove( buffers_.begin(), buffers_.end(), nullptr ), buffers_.end() );
+  num_released_ = 0;
+
+  size_t total_channels = 0;
+  for ( InputBufferStorage* storage : buffers_ )
+  {
+    total_channels += storage->num_channels_;
+  }
+
+  // The new values are allocated and written by the thread owning the arena
+  std::vector< double > values( num_slots * total_channels, 0.0 );
+
+  size_t offset = 0;
+  for ( size_t entry = 0; entry < buffers_.size(); ++entry )
+  {
+    InputBufferStorage& storage = *buffers_[ entry ];
+    const size_t num_channels = storage.num_channels_;
+
+    size_t begin;
+    size_t slot_stride;
+    if ( layout_ == Layout::NODE_MAJOR )
+    {
+      begin = offset * num_slots;
+      slot_stride = num_channels;
+    }
+    else
+    {
+      begin = offset;
+      slot_stride = total_channels;
+    }
+
+    for ( size_t slot = 0; slot < std::min( num_slots, storage.num_slots_ ); ++slot )
+    {
+      std::copy( storage.values( slot ), storage.values( slot ) + num_channels, &values[ begin + slot * slot_stride ] );
+    }
+
+    std::vector< double >().swap( storage.own_values_ );
+    storage.num_slots_ = num_slots;
+    storage.slot_stride_ = slot_stride;
+    storage.data_ = values.data() + begin;
+    storage.entry_ = entry;
+
+    offset += num_channels;
+  }
+
+  // swapping keeps the memory the buffers point to
+  values_.swap( values );
+  num_slots_ = num_slots;
+  changed_ = false;
+}
+
+InputBufferArena::Layout
+InputBufferArena::layout_from_name( const std::string& name )
+{
+  if ( name == "individual" )
+  {
+    return Layout::INDIVIDUAL;
+  }
+  if ( name == "node_major" )
+  {
+    return Layout::NODE_MAJOR;
+  }
+  if ( name == "slot_major" )
+  {
+    return Layout::SLOT_MAJOR;
+  }
+  throw BadProperty( "input_buffer_layout must be 'individual', 'node_major' or 'slot_major'." );
+}
+
+std::string
+InputBufferArena::layout_name( const Layout layout )
+{
+  switch ( layout )
+  {
+  case Layout::NODE_MAJOR:
+    return "node_major";
+  case Layout::SLOT_MAJOR:
+    return "slot_major";
+  default:
+    return "individual";
+  }
+}
+
+} // namespace nest
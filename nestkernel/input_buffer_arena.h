@@ -0,0 +1,193 @@
+/*
+ *  input_buffer_arena.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INPUT_BUFFER_ARENA_H
+#define INPUT_BUFFER_ARENA_H
+
+// C++ includes:
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace nest
+{
+
+class InputBufferArena;
+
+/**
+ * Storage of the values of an input buffer with a number of channels per
+ * ring buffer slot.
+ *
+ * The values are either kept in a vector owned by the storage or, after the
+ * buffer has been registered with the InputBufferArena of its thread, in the
+ * arena. In both cases, the channels of a slot are contiguous and slots are
+ * a fixed stride apart, so that access does not depend on where the values
+ * are kept.
+ *
+ * Copies always keep their values in a vector of their own. Moved storage
+ * remains registered with the arena.
+ */
+class InputBufferStorage
+{
+public:
+  //! Create storage for min_delay + max_delay slots in a vector of its own
+  explicit InputBufferStorage( const size_t num_channels );
+
+  InputBufferStorage( const InputBufferStorage& );
+  InputBufferStorage( InputBufferStorage&& ) noexcept;
+  ~InputBufferStorage();
+
+  InputBufferStorage& operator=( const InputBufferStorage& );
+  InputBufferStorage& operator=( InputBufferStorage&& ) noexcept;
+
+  double&
+  value( const size_t slot, const size_t channel )
+  {
+    assert( slot < num_slots_ and channel < num_channels_ );
+    return data_[ slot * slot_stride_ + channel ];
+  }
+
+  //! Values of all channels of the given slot
+  const double*
+  values( const size_t slot ) const
+  {
+    assert( slot < num_slots_ );
+    return data_ + slot * slot_stride_;
+  }
+
+  size_t
+  num_slots() const
+  {
+    return num_slots_;
+  }
+
+  /**
+   * Resize to min_delay + max_delay slots, keeping the values of existing
+   * slots. Storage in an arena is resized when the arena is laid out anew.
+   */
+  void resize();
+
+  /**
+   * Resize, register with the arena of the current thread if the arena is
+   * open, and set all values to zero.
+   */
+  void clear();
+
+private:
+  friend class InputBufferArena;
+
+  //! Release the registration with the arena, if any
+  void release_();
+
+  //! Set the values to the given slots and channels of other and point data_ to them
+  void assign_values_( const InputBufferStorage& other );
+
+  size_t num_channels_;
+  size_t num_slots_;
+  size_t slot_stride_;
+  double* data_;
+
+  std::vector< double > own_values_; //!< Values, unless kept in an arena
+  InputBufferArena* arena_;          //!< Arena the storage is registered with, or nullptr
+  size_t entry_;                     //!< Index of the storage in the arena
+};
+
+/**
+ * Contiguous memory for the input buffers of all nodes of one thread.
+ *
+ * With the kernel property input_buffer_layout set to "node_major" or
+ * "slot_major", the RingBuffer and MultiChannelInputBuffer objects of a
+ * node register with the arena of the node's thread when they are cleared
+ * while the node is prepared. When all nodes of the thread have been
+ * prepared, close() moves the values of all registered buffers into a single
+ * allocation made by the thread itself, so that the memory is local to the
+ * thread's NUMA domain, and points the buffers to their part of it. Buffers
+ * thus hold an offset into the arena instead of a vector of their own.
+ *
+ * In the "node_major" layout, the values are ordered by buffer, slot and
+ * channel, so the slots of a buffer are contiguous. In the "slot_major"
+ * layout, they are ordered by slot, buffer and channel, so the values of all
+ * buffers of the thread for one slot are contiguous.
+ *
+ * The arena is only laid out anew if buffers have been added or removed or
+ * the number of slots has changed.
+ */
+class InputBufferArena
+{
+public:
+  enum class Layout
+  {
+    INDIVIDUAL, //!< Each buffer keeps its values in a vector of its own
+    NODE_MAJOR,
+    SLOT_MAJOR
+  };
+
+  InputBufferArena();
+
+  InputBufferArena( const InputBufferArena& ) = delete;
+  InputBufferArena( InputBufferArena&& ) = default;
+  InputBufferArena& operator=( const InputBufferArena& ) = delete;
+
+  //! Accept buffers until close() using the given layout
+  void open( const Layout );
+
+  bool
+  is_open() const
+  {
+    return open_;
+  }
+
+  //! Lay out the values of the registered buffers and stop accepting buffers
+  void close();
+
+  //! Number of buffers registered
+  size_t
+  size() const
+  {
+    return buffers_.size() - num_released_;
+  }
+
+  //! Convert name of a layout to layout, throws BadProperty for unknown names
+  static Layout layout_from_name( const std::string& );
+  static std::string layout_name( const Layout );
+
+private:
+  friend class InputBufferStorage;
+
+  void add_( InputBufferStorage* );
+  void release_( const size_t entry );
+  void rebind_( const size_t entry, InputBufferStorage* );
+
+  Layout layout_;
+  bool open_;
+  bool changed_; //!< Buffers have been added or released since the last layout
+  size_t num_slots_;
+  size_t num_released_;
+
+  std::vector< double > values_;
+  std::vector< InputBufferStorage* > buffers_; //!< Registered buffers, nullptr if released
+};
+
+} // namespace nest
+
+#endif /* #ifndef INPUT_BUFFER_ARENA_H */
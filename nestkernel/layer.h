@@ -37,6 +37,7 @@
 #include "dictutils.h"
 
 // Includes from spatial:
+#include "cell_list.h"
 #include "connection_creator.h"
 #include "ntree.h"
 #include "position.h"
@@ -356,6 +357,20 @@ public:
     Position< D > extent,
     NodeCollectionPTR node_collection );
 
+  /**
+   * Get positions of the nodes in the layer which lie inside the given
+   * region, including nodes on other MPI processes. Each MPI process only
+   * receives the positions inside its own region, so that positions of
+   * the whole layer are not replicated on every process. The geometry
+   * arguments have the same meaning as for get_global_positions_ntree().
+   * Positions are not cached. Must be called on all MPI processes.
+   */
+  std::shared_ptr< Ntree< D, index > > get_region_positions_ntree( std::bitset< D > periodic,
+    Position< D > lower_left,
+    Position< D > extent,
+    NodeCollectionPTR node_collection,
+    const Box< D >& region );
+
   std::vector< std::pair< Position< D >, index > >* get_global_positions_vector( NodeCollectionPTR node_collection );
 
   virtual std::vector< std::pair< Position< D >, index > > get_global_positions_vector( const MaskDatum& mask,
@@ -432,6 +447,18 @@ protected:
   virtual void insert_global_positions_vector_( std::vector< std::pair< Position< D >, index > >&,
     NodeCollectionPTR ) = 0;
 
+  /**
+   * Insert position info for all nodes inside the region into ntree.
+   */
+  virtual void
+  insert_region_positions_ntree_( Ntree< D, index >& tree, NodeCollectionPTR node_collection, const Box< D >& region ) = 0;
+
+  /**
+   * @returns true if the position, or one of its images in the periodic
+   * dimensions of the ntree, lies inside the region.
+   */
+  static bool is_in_region_( const Position< D >& pos, const Box< D >& region, const Ntree< D, index >& tree );
+
   //! lower left corner (minimum coordinates) of layer
   Position< D > lower_left_;
   Position< D > extent_;      //!< size of layer
@@ -461,8 +488,16 @@ public:
    * @param allow_oversized If true, allow larges masks than layers when using
    *                        periodic b.c.
    * @param node_collection NodeCollection of the layer
+   * @param anchor_region   If given, the mask will only be applied with
+   *                        anchors inside this region, and only positions of
+   *                        nodes which may be inside the mask are fetched
+   *                        from other MPI processes.
    */
-  MaskedLayer( Layer< D >& layer, const MaskDatum& mask, bool allow_oversized, NodeCollectionPTR node_collection );
+  MaskedLayer( Layer< D >& layer,
+    const MaskDatum& mask,
+    bool allow_oversized,
+    NodeCollectionPTR node_collection,
+    const Box< D >* anchor_region = 0 );
 
   /**
    * Constructor for applying "converse" mask to layer. To be used for
@@ -474,12 +509,15 @@ public:
    * @param allow_oversized If true, allow larges masks than layers when using periodic b.c.
    * @param target          The layer which the given mask is defined for (target layer)
    * @param node_collection NodeCollection of the layer
+   * @param anchor_region   If given, the mask will only be applied with
+   *                        anchors inside this region, see above.
    */
   MaskedLayer( Layer< D >& layer,
     const MaskDatum& mask,
     bool allow_oversized,
     Layer< D >& target,
-    NodeCollectionPTR node_collection );
+    NodeCollectionPTR node_collection,
+    const Box< D >* anchor_region = 0 );
 
   ~MaskedLayer();
 
@@ -496,6 +534,21 @@ public:
    */
   typename Ntree< D, index >::masked_iterator end();
 
+  /**
+   * Build a cell list over the nodes of the layer, which get_nodes() then
+   * queries instead of the ntree. Must not be called from parallel regions.
+   */
+  void build_cell_list();
+
+  /**
+   * Append the nodes inside the mask centered on the anchor position to the
+   * given vector. Uses the cell list if one has been built, and the ntree
+   * otherwise.
+   * @param anchor Position to apply mask to
+   * @param nodes  Vector of (position, node ID) pairs to append to
+   */
+  void get_nodes( const Position< D >& anchor, std::vector< std::pair< Position< D >, index > >& nodes );
+
 protected:
   /**
    * Will check that the mask can be applied to the layer. The mask must
@@ -509,7 +562,14 @@ protected:
    */
   void check_mask_( Layer< D >& layer, bool allow_oversized );
 
+  /**
+   * @returns the region covered by the mask when applied with anchors
+   * inside the given region.
+   */
+  Box< D > get_mask_region_( const Box< D >& anchor_region ) const;
+
   std::shared_ptr< Ntree< D, index > > ntree_;
+  std::shared_ptr< CellList< D, index > > cell_list_;
   MaskDatum mask_;
 };
 
@@ -530,12 +590,24 @@ template < int D >
 inline MaskedLayer< D >::MaskedLayer( Layer< D >& layer,
   const MaskDatum& maskd,
   bool allow_oversized,
-  NodeCollectionPTR node_collection )
+  NodeCollectionPTR node_collection,
+  const Box< D >* anchor_region )
   : mask_( maskd )
 {
-  ntree_ = layer.get_global_positions_ntree( node_collection );
-
   check_mask_( layer, allow_oversized );
+
+  if ( anchor_region )
+  {
+    ntree_ = layer.get_region_positions_ntree( layer.get_periodic_mask(),
+      layer.get_lower_left(),
+      layer.get_extent(),
+      node_collection,
+      get_mask_region_( *anchor_region ) );
+  }
+  else
+  {
+    ntree_ = layer.get_global_positions_ntree( node_collection );
+  }
 }
 
 template < int D >
@@ -543,14 +615,26 @@ inline MaskedLayer< D >::MaskedLayer( Layer< D >& layer,
   const MaskDatum& maskd,
   bool allow_oversized,
   Layer< D >& target,
-  NodeCollectionPTR node_collection )
+  NodeCollectionPTR node_collection,
+  const Box< D >* anchor_region )
   : mask_( maskd )
 {
-  ntree_ = layer.get_global_positions_ntree(
-    target.get_periodic_mask(), target.get_lower_left(), target.get_extent(), node_collection );
-
   check_mask_( target, allow_oversized );
   mask_ = new ConverseMask< D >( dynamic_cast< const Mask< D >& >( *mask_ ) );
+
+  if ( anchor_region )
+  {
+    ntree_ = layer.get_region_positions_ntree( target.get_periodic_mask(),
+      target.get_lower_left(),
+      target.get_extent(),
+      node_collection,
+      get_mask_region_( *anchor_region ) );
+  }
+  else
+  {
+    ntree_ = layer.get_global_positions_ntree(
+      target.get_periodic_mask(), target.get_lower_left(), target.get_extent(), node_collection );
+  }
 }
 
 template < int D >
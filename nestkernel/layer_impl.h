@@ -31,6 +31,7 @@
 #include "node_collection.h"
 
 // Includes from spatial:
+#include "cell_list_impl.h"
 #include "grid_layer.h"
 #include "grid_mask.h"
 
@@ -178,6 +179,63 @@ Layer< D >::get_global_positions_ntree( std::bitset< D > periodic,
   return cached_ntree_;
 }
 
+template < int D >
+std::shared_ptr< Ntree< D, index > >
+Layer< D >::get_region_positions_ntree( std::bitset< D > periodic,
+  Position< D > lower_left,
+  Position< D > extent,
+  NodeCollectionPTR node_collection,
+  const Box< D >& region )
+{
+  // Keep layer geometry for non-periodic dimensions
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( not periodic[ i ] )
+    {
+      extent[ i ] = extent_[ i ];
+      lower_left[ i ] = lower_left_[ i ];
+    }
+  }
+
+  std::shared_ptr< Ntree< D, index > > ntree( new Ntree< D, index >( this->lower_left_, extent, periodic ) );
+  insert_region_positions_ntree_( *ntree, node_collection, region );
+
+  return ntree;
+}
+
+template < int D >
+bool
+Layer< D >::is_in_region_( const Position< D >& pos, const Box< D >& region, const Ntree< D, index >& tree )
+{
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( tree.get_periodic_mask()[ i ] )
+    {
+      const double ext = tree.get_extent()[ i ];
+      if ( region.upper_right[ i ] - region.lower_left[ i ] >= ext )
+      {
+        continue;
+      }
+      // Check the position and its images in the neighbouring periods.
+      bool inside = false;
+      for ( int k = -1; k <= 1; ++k )
+      {
+        const double x = pos[ i ] + k * ext;
+        inside |= region.lower_left[ i ] <= x and x <= region.upper_right[ i ];
+      }
+      if ( not inside )
+      {
+        return false;
+      }
+    }
+    else if ( pos[ i ] < region.lower_left[ i ] or pos[ i ] > region.upper_right[ i ] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 template < int D >
 std::shared_ptr< Ntree< D, index > >
 Layer< D >::do_get_global_positions_ntree_( NodeCollectionPTR node_collection )
@@ -350,6 +408,45 @@ Layer< D >::dump_connections( std::ostream& out,
   }
 }
 
+template < int D >
+Box< D >
+MaskedLayer< D >::get_mask_region_( const Box< D >& anchor_region ) const
+{
+  const Box< D > bb = dynamic_cast< const Mask< D >& >( *mask_ ).get_bbox();
+  return Box< D >( anchor_region.lower_left + bb.lower_left, anchor_region.upper_right + bb.upper_right );
+}
+
+template < int D >
+void
+MaskedLayer< D >::build_cell_list()
+{
+  if ( cell_list_.get() )
+  {
+    return;
+  }
+
+  const Mask< D >& mask = dynamic_cast< const Mask< D >& >( *mask_ );
+  cell_list_ = std::shared_ptr< CellList< D, index > >( new CellList< D, index >( ntree_->get_lower_left(),
+    ntree_->get_extent(),
+    ntree_->get_periodic_mask(),
+    CellList< D, index >::cell_size_for( mask, ntree_->get_extent(), ntree_->size() ) ) );
+  cell_list_->insert( ntree_->get_nodes() );
+}
+
+template < int D >
+void
+MaskedLayer< D >::get_nodes( const Position< D >& anchor, std::vector< std::pair< Position< D >, index > >& nodes )
+{
+  if ( cell_list_.get() )
+  {
+    cell_list_->get_nodes( dynamic_cast< const Mask< D >& >( *mask_ ), anchor, nodes );
+  }
+  else
+  {
+    std::copy( begin( anchor ), end(), std::back_inserter( nodes ) );
+  }
+}
+
 template < int D >
 void
 MaskedLayer< D >::check_mask_( Layer< D >& layer, bool allow_oversized )
@@ -257,6 +257,27 @@ public:
    */
   static Name get_name();
 
+  /**
+   * @returns true if the box is rotated
+   */
+  bool
+  is_rotated() const
+  {
+    return is_rotated_;
+  }
+
+  const Position< D >&
+  get_lower_left() const
+  {
+    return lower_left_;
+  }
+
+  const Position< D >&
+  get_upper_right() const
+  {
+    return upper_right_;
+  }
+
 protected:
   /**
    *  Calculate the min/max x, y, z values in case of a rotated box.
@@ -358,6 +379,18 @@ public:
    */
   static Name get_name();
 
+  const Position< D >&
+  get_center() const
+  {
+    return center_;
+  }
+
+  double
+  get_radius() const
+  {
+    return radius_;
+  }
+
 protected:
   Position< D > center_;
   double radius_;
@@ -675,6 +708,15 @@ public:
 
   Mask< D >* clone() const;
 
+  /**
+   * @returns the mask of which this mask is the converse
+   */
+  const Mask< D >&
+  get_mask() const
+  {
+    return *m_;
+  }
+
 protected:
   Mask< D >* m_;
 };
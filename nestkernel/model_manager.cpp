@@ -368,6 +368,12 @@ ModelManager::set_synapse_defaults_( index model_id, const DictionaryDatum& para
 
   ALL_ENTRIES_ACCESSED( *params, "ModelManager::set_synapse_defaults_", "Unread dictionary entries: " );
   model_defaults_modified_ = true;
+
+  // The volume transmitter of the model may have changed between runs
+  if ( kernel().simulation_manager.has_been_prepared() )
+  {
+    kernel().connection_manager.prepare();
+  }
 }
 
 index
@@ -237,6 +237,18 @@ public:
   template < class D >
   void communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
+  /**
+   * Exchange variable amounts of data between all ranks. The send buffer
+   * contains the data for all ranks in rank order, send_counts[ r ] elements
+   * for rank r. On return, the receive buffer contains the data received
+   * from all ranks, in rank order. The size of D must be a multiple of the
+   * size of unsigned int.
+   */
+  template < class D >
+  void communicate_Alltoallv( std::vector< D >& send_buffer,
+    std::vector< int >& send_counts,
+    std::vector< D >& recv_buffer );
+
   void synchronize();
 
   bool any_true( const bool );
@@ -793,6 +805,43 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
     &recv_displacements_secondary_events_in_int_per_rank_[ 0 ] );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  std::vector< int >& send_counts,
+  std::vector< D >& recv_buffer )
+{
+  static_assert( sizeof( D ) % sizeof( unsigned int ) == 0, "Size of D must be a multiple of size of unsigned int." );
+  const int ints_per_element = sizeof( D ) / sizeof( unsigned int );
+
+  assert( send_counts.size() == static_cast< size_t >( num_processes_ ) );
+  std::vector< int > recv_counts( num_processes_ );
+  communicate_Alltoall( send_counts, recv_counts, 1 );
+
+  std::vector< int > send_counts_in_int( num_processes_ );
+  std::vector< int > send_displacements_in_int( num_processes_, 0 );
+  std::vector< int > recv_counts_in_int( num_processes_ );
+  std::vector< int > recv_displacements_in_int( num_processes_, 0 );
+  for ( int rank = 0; rank < num_processes_; ++rank )
+  {
+    send_counts_in_int[ rank ] = ints_per_element * send_counts[ rank ];
+    recv_counts_in_int[ rank ] = ints_per_element * recv_counts[ rank ];
+  }
+  std::partial_sum(
+    send_counts_in_int.begin(), send_counts_in_int.end() - 1, send_displacements_in_int.begin() + 1 );
+  std::partial_sum(
+    recv_counts_in_int.begin(), recv_counts_in_int.end() - 1, recv_displacements_in_int.begin() + 1 );
+
+  recv_buffer.resize( std::accumulate( recv_counts.begin(), recv_counts.end(), 0 ) );
+
+  communicate_Alltoallv_( static_cast< void* >( send_buffer.data() ),
+    &send_counts_in_int[ 0 ],
+    &send_displacements_in_int[ 0 ],
+    static_cast< void* >( recv_buffer.data() ),
+    &recv_counts_in_int[ 0 ],
+    &recv_displacements_in_int[ 0 ] );
+}
+
 #else // HAVE_MPI
 template < class D >
 void
@@ -810,6 +859,13 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer, std::vector< int >&, std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif // HAVE_MPI
 
 template < class D >
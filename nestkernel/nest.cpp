@@ -29,6 +29,7 @@
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
+#include "network_snapshot.h"
 #include "parameter.h"
 
 // Includes from sli:
@@ -255,6 +256,18 @@ cleanup()
   kernel().cleanup();
 }
 
+void
+save_network( const std::string& prefix )
+{
+  NetworkSnapshot::save( prefix );
+}
+
+void
+load_network( const std::string& prefix )
+{
+  NetworkSnapshot::load( prefix );
+}
+
 void
 copy_model( const Name& oldmodname, const Name& newmodname, const DictionaryDatum& dict )
 {
@@ -187,6 +187,26 @@ void prepare();
  */
 void cleanup();
 
+/**
+ * @fn save_network(const std::string& prefix)
+ * @brief write a binary snapshot of the network
+ *
+ * Each rank writes the file <prefix>-<rank>.nestsnap.
+ *
+ * @see load_network()
+ */
+void save_network( const std::string& prefix );
+
+/**
+ * @fn load_network(const std::string& prefix)
+ * @brief create the network stored in a binary snapshot
+ *
+ * The network must be empty.
+ *
+ * @see save_network()
+ */
+void load_network( const std::string& prefix );
+
 void copy_model( const Name& oldmodname, const Name& newmodname, const DictionaryDatum& dict );
 
 void set_model_defaults( const std::string model_name, const DictionaryDatum& );
@@ -53,6 +53,7 @@ const Name adaptive_spike_buffers( "adaptive_spike_buffers" );
 const Name adaptive_target_buffers( "adaptive_target_buffers" );
 const Name after_spike_currents( "after_spike_currents" );
 const Name ahp_bug( "ahp_bug" );
+const Name alias_sampling( "alias_sampling" );
 const Name allow_autapses( "allow_autapses" );
 const Name allow_multapses( "allow_multapses" );
 const Name allow_offgrid_times( "allow_offgrid_times" );
@@ -212,6 +213,7 @@ const Name gaussian( "gaussian" );
 const Name global_id( "global_id" );
 const Name grid( "grid" );
 const Name grid3d( "grid3d" );
+const Name group_nodes_by_model( "group_nodes_by_model" );
 const Name growth_curve( "growth_curve" );
 const Name growth_curves( "growth_curves" );
 const Name growth_factor_buffer_spike_data( "growth_factor_buffer_spike_data" );
@@ -246,8 +248,10 @@ const Name index_map( "index_map" );
 const Name individual_spike_trains( "individual_spike_trains" );
 const Name init_flag( "init_flag" );
 const Name inner_radius( "inner_radius" );
+const Name input_buffer_layout( "input_buffer_layout" );
 const Name instant_unblock_NMDA( "instant_unblock_NMDA" );
 const Name instantiations( "instantiations" );
+const Name interpolation_tol( "interpolation_tol" );
 const Name interval( "interval" );
 const Name is_refractory( "is_refractory" );
 
@@ -259,6 +263,7 @@ const Name kernel( "kernel" );
 const Name label( "label" );
 const Name lambda( "lambda" );
 const Name lambda_0( "lambda_0" );
+const Name lazy_update( "lazy_update" );
 const Name len_kernel( "len_kernel" );
 const Name linear( "linear" );
 const Name linear_summation( "linear_summation" );
@@ -336,12 +341,14 @@ const Name p_copy( "p_copy" );
 const Name p_transmit( "p_transmit" );
 const Name pairwise_bernoulli_on_source( "pairwise_bernoulli_on_source" );
 const Name pairwise_bernoulli_on_target( "pairwise_bernoulli_on_target" );
+const Name parallel_sampling( "parallel_sampling" );
 const Name phase( "phase" );
 const Name phi_max( "phi_max" );
 const Name polar_angle( "polar_angle" );
 const Name polar_axis( "polar_axis" );
 const Name port( "port" );
 const Name port_name( "port_name" );
+const Name port_stride( "port_stride" );
 const Name port_width( "port_width" );
 const Name ports( "ports" );
 const Name positions( "positions" );
@@ -358,6 +365,7 @@ const Name psi( "psi" );
 const Name published( "published" );
 const Name pulse_times( "pulse_times" );
 const Name parent_idx( "parent_idx" );
+const Name partition_positions( "partition_positions" );
 const Name params( "params" );
 
 const Name q_rr( "q_rr" );
@@ -425,10 +433,13 @@ const Name start( "start" );
 const Name state( "state" );
 const Name std( "std" );
 const Name std_mod( "std_mod" );
+const Name stdp_fast_exp( "stdp_fast_exp" );
+const Name stdp_trace_cache( "stdp_trace_cache" );
 const Name stimulation_backends( "stimulation_backends" );
 const Name stimulator( "stimulator" );
 const Name stimulus_source( "stimulus_source" );
 const Name stop( "stop" );
+const Name structural_plasticity_point_to_point( "structural_plasticity_point_to_point" );
 const Name structural_plasticity_synapses( "structural_plasticity_synapses" );
 const Name structural_plasticity_update_interval( "structural_plasticity_update_interval" );
 const Name synapse_id( "synapse_id" );
@@ -554,6 +565,7 @@ const Name u_bar_plus( "u_bar_plus" );
 const Name u_ref_squared( "u_ref_squared" );
 const Name update_time_limit( "update_time_limit" );
 const Name upper_right( "upper_right" );
+const Name use_cell_list( "use_cell_list" );
 const Name use_compressed_spikes( "use_compressed_spikes" );
 const Name use_wfr( "use_wfr" );
 
@@ -574,6 +586,7 @@ const Name V_th_max( "V_th_max" );
 const Name V_th_rest( "V_th_rest" );
 const Name V_th_v( "V_th_v" );
 const Name val_eta( "val_eta" );
+const Name vectorized_update( "vectorized_update" );
 const Name voltage_clamp( "voltage_clamp" );
 const Name voltage_reset_add( "voltage_reset_add" );
 const Name voltage_reset_fraction( "voltage_reset_fraction" );
@@ -77,6 +77,7 @@ extern const Name adaptive_spike_buffers;
 extern const Name adaptive_target_buffers;
 extern const Name after_spike_currents;
 extern const Name ahp_bug;
+extern const Name alias_sampling;
 extern const Name allow_autapses;
 extern const Name allow_multapses;
 extern const Name allow_offgrid_times;
@@ -236,6 +237,7 @@ extern const Name gamma_shape;
 extern const Name gaussian;
 extern const Name global_id;
 extern const Name grid3d;
+extern const Name group_nodes_by_model;
 extern const Name grid;
 extern const Name growth_curve;
 extern const Name growth_curves;
@@ -270,8 +272,10 @@ extern const Name index_map;
 extern const Name individual_spike_trains;
 extern const Name init_flag;
 extern const Name inner_radius;
+extern const Name input_buffer_layout;
 extern const Name instant_unblock_NMDA;
 extern const Name instantiations;
+extern const Name interpolation_tol;
 extern const Name interval;
 extern const Name is_refractory;
 
@@ -283,6 +287,7 @@ extern const Name kernel;
 extern const Name label;
 extern const Name lambda;
 extern const Name lambda_0;
+extern const Name lazy_update;
 extern const Name len_kernel;
 extern const Name linear;
 extern const Name linear_summation;
@@ -360,14 +365,17 @@ extern const Name p_copy;
 extern const Name p_transmit;
 extern const Name pairwise_bernoulli_on_source;
 extern const Name pairwise_bernoulli_on_target;
+extern const Name parallel_sampling;
 extern const Name params;
 extern const Name parent_idx;
+extern const Name partition_positions;
 extern const Name phase;
 extern const Name phi_max;
 extern const Name polar_angle;
 extern const Name polar_axis;
 extern const Name port;
 extern const Name port_name;
+extern const Name port_stride;
 extern const Name port_width;
 extern const Name ports;
 extern const Name positions;
@@ -449,10 +457,13 @@ extern const Name start;
 extern const Name state;
 extern const Name std;
 extern const Name std_mod;
+extern const Name stdp_fast_exp;
+extern const Name stdp_trace_cache;
 extern const Name stimulation_backends;
 extern const Name stimulator;
 extern const Name stimulus_source;
 extern const Name stop;
+extern const Name structural_plasticity_point_to_point;
 extern const Name structural_plasticity_synapses;
 extern const Name structural_plasticity_update_interval;
 extern const Name synapse_id;
@@ -578,6 +589,7 @@ extern const Name u_bar_plus;
 extern const Name u_ref_squared;
 extern const Name update_time_limit;
 extern const Name upper_right;
+extern const Name use_cell_list;
 extern const Name use_compressed_spikes;
 extern const Name use_wfr;
 
@@ -598,6 +610,7 @@ extern const Name V_th_max;
 extern const Name V_th_rest;
 extern const Name V_th_v;
 extern const Name val_eta;
+extern const Name vectorized_update;
 extern const Name voltage_clamp;
 extern const Name voltage_reset_add;
 extern const Name voltage_reset_fraction;
@@ -761,6 +761,70 @@ NestModule::CleanupFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: SaveNetwork - write a binary snapshot of the network
+
+   Synopsis:
+   prefix SaveNetwork -> -
+
+   Parameters:
+   prefix - string, path prefix of the snapshot files
+
+   Description:
+   Each rank writes its local nodes and the connections stored on each
+   of its threads to the file prefix-rank.nestsnap. Nodes are stored
+   with the parameters and state variables in which they differ from the
+   model defaults, connections with their raw contents. Recorded data,
+   kernel parameters, model defaults and copied models are not stored.
+   Connections to and from devices are not supported.
+
+   Snapshots can only be loaded by the NEST build that wrote them.
+
+   SeeAlso: LoadNetwork
+*/
+void
+NestModule::SaveNetwork_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 0 ) );
+  save_network( prefix );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: LoadNetwork - create the network stored in a binary snapshot
+
+   Synopsis:
+   prefix LoadNetwork -> -
+
+   Parameters:
+   prefix - string, path prefix of the snapshot files
+
+   Description:
+   Creates the nodes and connections stored by SaveNetwork. The network
+   must be empty. Kernel parameters, in particular the resolution, model
+   defaults and copied models must be set up as when the snapshot was
+   written. If the numbers of MPI processes and threads are unchanged,
+   each rank maps its own file and copies the connections in bulk;
+   otherwise, all ranks read all files.
+
+   SeeAlso: SaveNetwork
+*/
+void
+NestModule::LoadNetwork_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 0 ) );
+  load_network( prefix );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: CopyModel - copy a model to a new name, set parameters for copy, if
    given
@@ -2925,6 +2989,8 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "Run_d", &runfunction );
   i->createcommand( "Prepare", &preparefunction );
   i->createcommand( "Cleanup", &cleanupfunction );
+  i->createcommand( "SaveNetwork_s", &savenetwork_sfunction );
+  i->createcommand( "LoadNetwork_s", &loadnetwork_sfunction );
 
   i->createcommand( "CopyModel_l_l_D", &copymodel_l_l_Dfunction );
   i->createcommand( "SetDefaults_l_D", &setdefaults_l_Dfunction );
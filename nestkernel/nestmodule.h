@@ -311,6 +311,18 @@ public:
     void execute( SLIInterpreter* ) const;
   } cleanupfunction;
 
+  class SaveNetwork_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } savenetwork_sfunction;
+
+  class LoadNetwork_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } loadnetwork_sfunction;
+
   class Create_l_iFunction : public SLIFunction
   {
   public:
@@ -0,0 +1,885 @@
+/*
+ *  network_snapshot.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "network_snapshot.h"
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <vector>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "archiving_node.h"
+#include "exceptions.h"
+#include "kernel_manager.h"
+#include "model.h"
+#include "nest_names.h"
+#include "vp_manager_impl.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "booldatum.h"
+#include "dictdatum.h"
+#include "doubledatum.h"
+#include "integerdatum.h"
+#include "namedatum.h"
+#include "sliexceptions.h"
+#include "stringdatum.h"
+
+namespace nest
+{
+namespace
+{
+
+const char snapshot_magic[ 8 ] = { 'N', 'E', 'S', 'T', 'S', 'N', 'A', 'P' };
+const std::uint32_t snapshot_version = 1;
+
+//! Marks the end of the connection blocks in a snapshot file.
+const std::uint32_t end_of_blocks = 0xffffffff;
+
+// Source and target node IDs are mapped directly from the file.
+static_assert( sizeof( index ) == sizeof( std::uint64_t ), "Network snapshots require 64 bit node IDs." );
+
+enum DatumTag : std::uint8_t
+{
+  DOUBLE_TAG,
+  INTEGER_TAG,
+  BOOL_TAG,
+  LITERAL_TAG,
+  STRING_TAG,
+  ARRAY_TAG,
+  DOUBLE_VECTOR_TAG,
+  INT_VECTOR_TAG,
+  DICTIONARY_TAG
+};
+
+/**
+ * Entries of the node status which are not stored. They are either
+ * read-only or contain recorded data.
+ */
+bool
+is_skipped_status_entry( const Name& name )
+{
+  return name == names::element_type or name == names::events or name == names::global_id or name == names::local
+    or name == names::model or name == names::model_id or name == names::n_events or name == names::node_uses_wfr
+    or name == names::thread or name == names::thread_local_id or name == names::vp;
+}
+
+/**
+ * Sequential binary writer. Data are collected in a buffer, which is
+ * written to the output stream, if one is given, when it grows large.
+ */
+class SnapshotWriter
+{
+public:
+  SnapshotWriter()
+    : out_( nullptr )
+    , flushed_( 0 )
+  {
+  }
+
+  explicit SnapshotWriter( std::ofstream& out )
+    : out_( &out )
+    , flushed_( 0 )
+  {
+  }
+
+  template < typename T >
+  void
+  write( const T& value )
+  {
+    write_bytes( &value, sizeof( T ) );
+  }
+
+  void
+  write_bytes( const void* data, const size_t n )
+  {
+    const char* bytes = static_cast< const char* >( data );
+    if ( out_ and n >= max_buffer_size )
+    {
+      flush();
+      out_->write( bytes, n );
+      flushed_ += n;
+      return;
+    }
+
+    buffer_.insert( buffer_.end(), bytes, bytes + n );
+    if ( out_ and buffer_.size() >= max_buffer_size )
+    {
+      flush();
+    }
+  }
+
+  void
+  write_string( const std::string& s )
+  {
+    write< std::uint64_t >( s.size() );
+    write_bytes( s.data(), s.size() );
+  }
+
+  /**
+   * Write the given token. Returns false and writes nothing if the token
+   * or one of its elements has an unsupported type. Only available for
+   * writers without output stream.
+   */
+  bool write_token( const Token& token );
+
+  /**
+   * Write the entries of the dictionary which have a supported type.
+   */
+  void write_dict( const DictionaryDatum& dict );
+
+  /**
+   * Pad the output to a multiple of eight bytes.
+   */
+  void
+  align()
+  {
+    const size_t padding = ( 8 - position() % 8 ) % 8;
+    buffer_.insert( buffer_.end(), padding, 0 );
+  }
+
+  void
+  flush()
+  {
+    if ( out_ )
+    {
+      out_->write( buffer_.data(), buffer_.size() );
+      flushed_ += buffer_.size();
+      buffer_.clear();
+    }
+  }
+
+  size_t
+  position() const
+  {
+    return flushed_ + buffer_.size();
+  }
+
+  const std::vector< char >&
+  buffer() const
+  {
+    return buffer_;
+  }
+
+private:
+  static const size_t max_buffer_size = 1 << 24;
+
+  std::ofstream* out_;
+  size_t flushed_;
+  std::vector< char > buffer_;
+};
+
+bool
+SnapshotWriter::write_token( const Token& token )
+{
+  assert( not out_ );
+  const size_t start = buffer_.size();
+  const Datum* datum = token.datum();
+
+  if ( const DoubleDatum* d = dynamic_cast< const DoubleDatum* >( datum ) )
+  {
+    write< std::uint8_t >( DOUBLE_TAG );
+    write< double >( d->get() );
+  }
+  else if ( const IntegerDatum* d = dynamic_cast< const IntegerDatum* >( datum ) )
+  {
+    write< std::uint8_t >( INTEGER_TAG );
+    write< std::int64_t >( d->get() );
+  }
+  else if ( const BoolDatum* d = dynamic_cast< const BoolDatum* >( datum ) )
+  {
+    write< std::uint8_t >( BOOL_TAG );
+    write< std::uint8_t >( static_cast< bool >( *d ) );
+  }
+  else if ( const LiteralDatum* d = dynamic_cast< const LiteralDatum* >( datum ) )
+  {
+    write< std::uint8_t >( LITERAL_TAG );
+    write_string( d->toString() );
+  }
+  else if ( const StringDatum* d = dynamic_cast< const StringDatum* >( datum ) )
+  {
+    write< std::uint8_t >( STRING_TAG );
+    write_string( *d );
+  }
+  else if ( const ArrayDatum* d = dynamic_cast< const ArrayDatum* >( datum ) )
+  {
+    write< std::uint8_t >( ARRAY_TAG );
+    write< std::uint64_t >( d->size() );
+    for ( size_t i = 0; i < d->size(); ++i )
+    {
+      if ( not write_token( ( *d )[ i ] ) )
+      {
+        buffer_.resize( start );
+        return false;
+      }
+    }
+  }
+  else if ( const DoubleVectorDatum* d = dynamic_cast< const DoubleVectorDatum* >( datum ) )
+  {
+    const std::vector< double >& v = **d;
+    write< std::uint8_t >( DOUBLE_VECTOR_TAG );
+    write< std::uint64_t >( v.size() );
+    write_bytes( v.data(), v.size() * sizeof( double ) );
+  }
+  else if ( const IntVectorDatum* d = dynamic_cast< const IntVectorDatum* >( datum ) )
+  {
+    const std::vector< long >& v = **d;
+    write< std::uint8_t >( INT_VECTOR_TAG );
+    write< std::uint64_t >( v.size() );
+    for ( const long value : v )
+    {
+      write< std::int64_t >( value );
+    }
+  }
+  else if ( const DictionaryDatum* d = dynamic_cast< const DictionaryDatum* >( datum ) )
+  {
+    write< std::uint8_t >( DICTIONARY_TAG );
+    write_dict( *d );
+  }
+  else
+  {
+    return false;
+  }
+
+  return true;
+}
+
+void
+SnapshotWriter::write_dict( const DictionaryDatum& dict )
+{
+  std::vector< std::pair< std::string, SnapshotWriter > > entries;
+  for ( auto it = dict->begin(); it != dict->end(); ++it )
+  {
+    SnapshotWriter value;
+    if ( value.write_token( it->second ) )
+    {
+      entries.emplace_back( it->first.toString(), value );
+    }
+  }
+
+  write< std::uint32_t >( entries.size() );
+  for ( auto& entry : entries )
+  {
+    write_string( entry.first );
+    write_bytes( entry.second.buffer().data(), entry.second.buffer().size() );
+  }
+}
+
+/**
+ * Sequential binary reader on a memory-mapped file.
+ */
+class SnapshotReader
+{
+public:
+  explicit SnapshotReader( const std::string& filename );
+  ~SnapshotReader();
+
+  SnapshotReader( const SnapshotReader& ) = delete;
+  SnapshotReader& operator=( const SnapshotReader& ) = delete;
+
+  template < typename T >
+  T
+  read()
+  {
+    T value;
+    std::memcpy( &value, read_bytes( sizeof( T ) ), sizeof( T ) );
+    return value;
+  }
+
+  /**
+   * Return a pointer to the next n bytes and advance past them.
+   */
+  const char*
+  read_bytes( const size_t n )
+  {
+    if ( n > static_cast< size_t >( end_ - pos_ ) )
+    {
+      throw KernelException( String::compose( "The network snapshot file '%1' is truncated.", filename_ ) );
+    }
+    const char* data = pos_;
+    pos_ += n;
+    return data;
+  }
+
+  std::string
+  read_string()
+  {
+    const size_t n = read< std::uint64_t >();
+    return std::string( read_bytes( n ), n );
+  }
+
+  Token read_token();
+  DictionaryDatum read_dict();
+
+  /**
+   * Skip the padding written by SnapshotWriter::align().
+   */
+  void
+  align()
+  {
+    read_bytes( ( 8 - ( pos_ - begin_ ) % 8 ) % 8 );
+  }
+
+  const std::string&
+  get_filename() const
+  {
+    return filename_;
+  }
+
+private:
+  std::string filename_;
+  void* map_;
+  size_t size_;
+  const char* begin_;
+  const char* pos_;
+  const char* end_;
+};
+
+SnapshotReader::SnapshotReader( const std::string& filename )
+  : filename_( filename )
+  , map_( MAP_FAILED )
+  , size_( 0 )
+{
+  const int fd = open( filename.c_str(), O_RDONLY );
+  struct stat file_stat;
+  if ( fd >= 0 and fstat( fd, &file_stat ) == 0 and file_stat.st_size > 0 )
+  {
+    size_ = file_stat.st_size;
+    map_ = mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+  }
+  if ( fd >= 0 )
+  {
+    close( fd );
+  }
+
+  if ( map_ == MAP_FAILED )
+  {
+    std::string msg = String::compose( "I/O error while reading file '%1'.", filename );
+    LOG( M_ERROR, "NetworkSnapshot::load()", msg );
+    throw IOError();
+  }
+
+  begin_ = static_cast< const char* >( map_ );
+  pos_ = begin_;
+  end_ = begin_ + size_;
+}
+
+SnapshotReader::~SnapshotReader()
+{
+  munmap( map_, size_ );
+}
+
+Token
+SnapshotReader::read_token()
+{
+  switch ( read< std::uint8_t >() )
+  {
+  case DOUBLE_TAG:
+    return Token( new DoubleDatum( read< double >() ) );
+  case INTEGER_TAG:
+    return Token( new IntegerDatum( read< std::int64_t >() ) );
+  case BOOL_TAG:
+    return Token( new BoolDatum( read< std::uint8_t >() != 0 ) );
+  case LITERAL_TAG:
+    return Token( new LiteralDatum( read_string() ) );
+  case STRING_TAG:
+    return Token( new StringDatum( read_string() ) );
+  case ARRAY_TAG:
+  {
+    const size_t n = read< std::uint64_t >();
+    ArrayDatum array;
+    array.reserve( n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      array.push_back( read_token() );
+    }
+    return Token( array );
+  }
+  case DOUBLE_VECTOR_TAG:
+  {
+    const size_t n = read< std::uint64_t >();
+    std::vector< double >* v = new std::vector< double >( n );
+    std::memcpy( v->data(), read_bytes( n * sizeof( double ) ), n * sizeof( double ) );
+    return Token( new DoubleVectorDatum( v ) );
+  }
+  case INT_VECTOR_TAG:
+  {
+    const size_t n = read< std::uint64_t >();
+    std::vector< long >* v = new std::vector< long >( n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      ( *v )[ i ] = read< std::int64_t >();
+    }
+    return Token( new IntVectorDatum( v ) );
+  }
+  case DICTIONARY_TAG:
+    return Token( read_dict() );
+  default:
+    throw KernelException( String::compose( "The network snapshot file '%1' is corrupt.", filename_ ) );
+  }
+}
+
+DictionaryDatum
+SnapshotReader::read_dict()
+{
+  DictionaryDatum dict( new Dictionary );
+  const size_t n = read< std::uint32_t >();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const std::string key = read_string();
+    ( *dict )[ Name( key ) ] = read_token();
+  }
+  return dict;
+}
+
+/**
+ * Global information at the beginning of each snapshot file.
+ */
+struct SnapshotHeader
+{
+  struct NodeRange
+  {
+    index first;
+    index last;
+    std::string model;
+  };
+
+  int num_processes;
+  int num_threads;
+  std::vector< std::string > synapse_models;
+  std::vector< NodeRange > node_ranges;
+};
+
+void
+write_header( SnapshotWriter& writer )
+{
+  writer.write_bytes( snapshot_magic, sizeof( snapshot_magic ) );
+  writer.write< std::uint32_t >( snapshot_version );
+  writer.write< std::uint32_t >( kernel().mpi_manager.get_num_processes() );
+  writer.write< std::uint32_t >( kernel().vp_manager.get_num_threads() );
+  writer.write< double >( Time::get_tics_per_ms() );
+  writer.write< std::int64_t >( Time::get_resolution().get_tics() );
+
+  const size_t num_synapse_models = kernel().model_manager.get_num_connection_models();
+  writer.write< std::uint64_t >( num_synapse_models );
+  for ( synindex syn_id = 0; syn_id < num_synapse_models; ++syn_id )
+  {
+    writer.write_string( kernel().model_manager.get_connection_model( syn_id ).get_name() );
+  }
+
+  const size_t num_ranges = kernel().modelrange_manager.end() - kernel().modelrange_manager.begin();
+  writer.write< std::uint64_t >( num_ranges );
+  for ( auto range = kernel().modelrange_manager.begin(); range != kernel().modelrange_manager.end(); ++range )
+  {
+    writer.write< std::uint64_t >( range->get_first_node_id() );
+    writer.write< std::uint64_t >( range->get_last_node_id() );
+    writer.write_string( kernel().model_manager.get_node_model( range->get_model_id() )->get_name() );
+  }
+}
+
+SnapshotHeader
+read_header( SnapshotReader& reader )
+{
+  if ( std::memcmp( reader.read_bytes( sizeof( snapshot_magic ) ), snapshot_magic, sizeof( snapshot_magic ) ) != 0
+    or reader.read< std::uint32_t >() != snapshot_version )
+  {
+    throw KernelException(
+      String::compose( "The file '%1' is not a network snapshot of this version of NEST.", reader.get_filename() ) );
+  }
+
+  SnapshotHeader header;
+  header.num_processes = reader.read< std::uint32_t >();
+  header.num_threads = reader.read< std::uint32_t >();
+
+  const double tics_per_ms = reader.read< double >();
+  const std::int64_t resolution = reader.read< std::int64_t >();
+  if ( tics_per_ms != Time::get_tics_per_ms() or resolution != Time::get_resolution().get_tics() )
+  {
+    throw KernelException(
+      "The network snapshot was written with a different resolution. "
+      "Set the resolution before loading the snapshot." );
+  }
+
+  header.synapse_models.resize( reader.read< std::uint64_t >() );
+  for ( auto& name : header.synapse_models )
+  {
+    name = reader.read_string();
+  }
+
+  header.node_ranges.resize( reader.read< std::uint64_t >() );
+  for ( auto& range : header.node_ranges )
+  {
+    range.first = reader.read< std::uint64_t >();
+    range.last = reader.read< std::uint64_t >();
+    range.model = reader.read_string();
+  }
+
+  return header;
+}
+
+/**
+ * Connections of one synapse type on one thread, mapped from a file.
+ */
+struct ConnectionBlock
+{
+  thread tid;
+  synindex syn_id;
+  size_t n;
+  size_t conn_size;
+  const index* source_node_ids;
+  const index* target_node_ids;
+  const char* data;
+};
+
+} // namespace
+
+std::string
+NetworkSnapshot::get_filename_( const std::string& prefix, const int rank )
+{
+  return String::compose( "%1-%2.nestsnap", prefix, rank );
+}
+
+void
+NetworkSnapshot::save( const std::string& prefix )
+{
+  if ( kernel().connection_manager.has_device_connections() )
+  {
+    throw NotImplemented(
+      "Network snapshots do not support connections to or from devices. "
+      "Connect devices after loading the snapshot." );
+  }
+
+  const std::string filename = get_filename_( prefix, kernel().mpi_manager.get_rank() );
+
+  std::ifstream test( filename.c_str() );
+  if ( test.good() and not kernel().io_manager.overwrite_files() )
+  {
+    std::string msg = String::compose(
+      "The file '%1' already exists and overwriting files is disabled. To overwrite files, set "
+      "the kernel property overwrite_files to true.",
+      filename );
+    LOG( M_ERROR, "NetworkSnapshot::save()", msg );
+    throw IOError();
+  }
+  test.close();
+
+  std::ofstream out( filename.c_str(), std::ios::binary );
+  if ( not out.good() )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+    LOG( M_ERROR, "NetworkSnapshot::save()", msg );
+    throw IOError();
+  }
+
+  SnapshotWriter writer( out );
+  write_header( writer );
+
+  // Nodes with proxies exist on one thread only, all other nodes are
+  // replicated on each thread and are written once.
+  std::vector< Node* > nodes;
+  for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    for ( auto& entry : kernel().node_manager.get_local_nodes( t ) )
+    {
+      Node* node = entry.get_node();
+      if ( node->has_proxies() or t == 0 )
+      {
+        nodes.push_back( node );
+      }
+    }
+  }
+
+  std::map< index, DictionaryDatum > model_defaults;
+  writer.write< std::uint64_t >( nodes.size() );
+  for ( Node* node : nodes )
+  {
+    ArchivingNode* archiving_node = dynamic_cast< ArchivingNode* >( node );
+    writer.write< std::uint64_t >( node->get_node_id() );
+    writer.write< std::uint64_t >( archiving_node ? archiving_node->get_num_stdp_connections() : 0 );
+    writer.write< double >( archiving_node ? archiving_node->get_max_stdp_delay() : 0.0 );
+
+    const index model_id = node->get_model_id();
+    if ( model_defaults.find( model_id ) == model_defaults.end() )
+    {
+      model_defaults[ model_id ] = kernel().model_manager.get_node_model( model_id )->get_status();
+    }
+    const DictionaryDatum& defaults = model_defaults[ model_id ];
+
+    // only store entries that differ from the model defaults
+    DictionaryDatum status = node->get_status_base();
+    DictionaryDatum changed( new Dictionary );
+    for ( auto it = status->begin(); it != status->end(); ++it )
+    {
+      if ( is_skipped_status_entry( it->first ) )
+      {
+        continue;
+      }
+      if ( defaults->known( it->first ) )
+      {
+        SnapshotWriter value;
+        SnapshotWriter default_value;
+        if ( value.write_token( it->second ) and default_value.write_token( defaults->lookup( it->first ) )
+          and value.buffer() == default_value.buffer() )
+        {
+          continue;
+        }
+      }
+      ( *changed )[ it->first ] = it->second;
+    }
+    writer.write_dict( changed );
+  }
+  writer.align();
+
+  std::vector< index > source_node_ids;
+  std::vector< index > target_node_ids;
+  std::vector< char > data;
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
+    {
+      source_node_ids.clear();
+      target_node_ids.clear();
+      data.clear();
+      kernel().connection_manager.dump_connections( tid, syn_id, source_node_ids, target_node_ids, data );
+
+      const size_t n = source_node_ids.size();
+      if ( n == 0 )
+      {
+        continue;
+      }
+
+      writer.write< std::uint32_t >( tid );
+      writer.write< std::uint32_t >( syn_id );
+      writer.write< std::uint64_t >( n );
+      writer.write< std::uint64_t >( data.size() / n );
+      writer.write_bytes( source_node_ids.data(), n * sizeof( index ) );
+      writer.write_bytes( target_node_ids.data(), n * sizeof( index ) );
+      writer.write_bytes( data.data(), data.size() );
+      writer.align();
+    }
+  }
+  writer.write< std::uint32_t >( end_of_blocks );
+  writer.flush();
+
+  if ( not out.good() )
+  {
+    std::string msg = String::compose( "I/O error while writing file '%1'.", filename );
+    LOG( M_ERROR, "NetworkSnapshot::save()", msg );
+    throw IOError();
+  }
+}
+
+void
+NetworkSnapshot::load( const std::string& prefix )
+{
+  if ( kernel().node_manager.size() > 0 )
+  {
+    throw KernelException( "Network snapshots can only be loaded into an empty network." );
+  }
+
+  const int rank = kernel().mpi_manager.get_rank();
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+
+  // The header of the first file determines whether the snapshot was written
+  // with the current numbers of ranks and threads. Then each rank only needs
+  // its own file, otherwise all files.
+  std::vector< std::unique_ptr< SnapshotReader > > readers;
+  readers.emplace_back( new SnapshotReader( get_filename_( prefix, 0 ) ) );
+  SnapshotHeader header = read_header( *readers[ 0 ] );
+
+  const bool same_layout =
+    header.num_processes == kernel().mpi_manager.get_num_processes() and header.num_threads == num_threads;
+  if ( same_layout and rank != 0 )
+  {
+    readers[ 0 ].reset( new SnapshotReader( get_filename_( prefix, rank ) ) );
+    header = read_header( *readers[ 0 ] );
+  }
+  if ( not same_layout )
+  {
+    for ( int r = 1; r < header.num_processes; ++r )
+    {
+      readers.emplace_back( new SnapshotReader( get_filename_( prefix, r ) ) );
+      read_header( *readers.back() );
+    }
+  }
+
+  for ( auto& range : header.node_ranges )
+  {
+    const index model_id = kernel().model_manager.get_node_model_id( range.model );
+    NodeCollectionPTR nodes = kernel().node_manager.add_node( model_id, range.last - range.first + 1 );
+    assert( ( *nodes )[ 0 ] == range.first );
+  }
+
+  std::map< std::string, synindex > syn_ids;
+  std::vector< ConnectionBlock > blocks;
+  for ( auto& reader : readers )
+  {
+    const size_t num_nodes = reader->read< std::uint64_t >();
+    for ( size_t i = 0; i < num_nodes; ++i )
+    {
+      const index node_id = reader->read< std::uint64_t >();
+      const size_t num_stdp_connections = reader->read< std::uint64_t >();
+      const double max_stdp_delay = reader->read< double >();
+      const DictionaryDatum status = reader->read_dict();
+
+      for ( thread t = 0; t < num_threads; ++t )
+      {
+        Node* node = kernel().node_manager.get_local_nodes( t ).get_node_by_node_id( node_id );
+        if ( node == nullptr )
+        {
+          continue;
+        }
+
+        node->set_status_base( status );
+
+        // The spike history of restored nodes is empty, so registering the
+        // STDP connections again yields the stored state.
+        ArchivingNode* archiving_node = dynamic_cast< ArchivingNode* >( node );
+        for ( size_t k = 0; archiving_node and k < num_stdp_connections; ++k )
+        {
+          archiving_node->register_stdp_connection( -max_stdp_delay, max_stdp_delay );
+        }
+      }
+    }
+    reader->align();
+
+    while ( true )
+    {
+      const std::uint32_t tid = reader->read< std::uint32_t >();
+      if ( tid == end_of_blocks )
+      {
+        break;
+      }
+
+      const std::uint32_t stored_syn_id = reader->read< std::uint32_t >();
+      if ( stored_syn_id >= header.synapse_models.size() )
+      {
+        throw KernelException(
+          String::compose( "The network snapshot file '%1' is corrupt.", reader->get_filename() ) );
+      }
+      const std::string& synapse_model = header.synapse_models[ stored_syn_id ];
+      if ( syn_ids.find( synapse_model ) == syn_ids.end() )
+      {
+        syn_ids[ synapse_model ] = kernel().model_manager.get_synapse_model_id( synapse_model );
+      }
+
+      ConnectionBlock block;
+      block.tid = tid;
+      block.syn_id = syn_ids[ synapse_model ];
+      block.n = reader->read< std::uint64_t >();
+      block.conn_size = reader->read< std::uint64_t >();
+      block.source_node_ids = reinterpret_cast< const index* >( reader->read_bytes( block.n * sizeof( index ) ) );
+      block.target_node_ids = reinterpret_cast< const index* >( reader->read_bytes( block.n * sizeof( index ) ) );
+      block.data = reader->read_bytes( block.n * block.conn_size );
+      reader->align();
+      blocks.push_back( block );
+    }
+  }
+
+  kernel().connection_manager.set_connections_have_changed();
+
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( num_threads );
+
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      std::vector< index > source_node_ids;
+      std::vector< index > target_node_ids;
+      std::vector< char > data;
+
+      for ( auto& block : blocks )
+      {
+        if ( same_layout )
+        {
+          // all targets of the block are local to the thread that stored it
+          if ( block.tid == tid )
+          {
+            kernel().connection_manager.restore_connections( tid,
+              block.syn_id,
+              block.source_node_ids,
+              block.target_node_ids,
+              block.data,
+              block.conn_size,
+              block.n );
+          }
+          continue;
+        }
+
+        source_node_ids.clear();
+        target_node_ids.clear();
+        data.clear();
+        for ( size_t i = 0; i < block.n; ++i )
+        {
+          const thread vp = kernel().vp_manager.node_id_to_vp( block.target_node_ids[ i ] );
+          if ( kernel().vp_manager.is_local_vp( vp ) and kernel().vp_manager.vp_to_thread( vp ) == tid )
+          {
+            source_node_ids.push_back( block.source_node_ids[ i ] );
+            target_node_ids.push_back( block.target_node_ids[ i ] );
+            data.insert( data.end(),
+              block.data + i * block.conn_size,
+              block.data + ( i + 1 ) * block.conn_size );
+          }
+        }
+        kernel().connection_manager.restore_connections( tid,
+          block.syn_id,
+          source_node_ids.data(),
+          target_node_ids.data(),
+          data.data(),
+          block.conn_size,
+          source_node_ids.size() );
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+
+  for ( thread tid = 0; tid < num_threads; ++tid )
+  {
+    if ( exceptions_raised.at( tid ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
+    }
+  }
+}
+
+} // namespace nest
@@ -0,0 +1,73 @@
+/*
+ *  network_snapshot.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NETWORK_SNAPSHOT_H
+#define NETWORK_SNAPSHOT_H
+
+// C++ includes:
+#include <string>
+
+namespace nest
+{
+
+/**
+ * Binary snapshots of a constructed network.
+ *
+ * A snapshot stores the nodes with the parameters and state variables in
+ * which they differ from their model defaults, and the raw contents of all
+ * connections between neurons. Each rank writes the file
+ * <prefix>-<rank>.nestsnap with its local nodes and the connections stored
+ * on each of its threads.
+ *
+ * Loading a snapshot replaces the construction of the network. If the
+ * numbers of ranks and threads are the same as when the snapshot was
+ * written, each rank maps its own file and copies the connections of each
+ * thread in bulk. Otherwise, every rank reads all files and keeps the nodes
+ * and connections whose targets are local to it.
+ *
+ * Snapshots are tied to the build of NEST that wrote them, as connections
+ * are stored in their in-memory layout. Kernel parameters, model defaults
+ * and synapse models created with CopyModel are not part of the snapshot and
+ * must be set up in the same way before loading. Connections to and from
+ * devices are not supported; devices can be connected after loading.
+ */
+class NetworkSnapshot
+{
+public:
+  /**
+   * Write a snapshot of the network to files with the given prefix.
+   */
+  static void save( const std::string& prefix );
+
+  /**
+   * Create the network stored in the snapshot with the given prefix. The
+   * network must be empty.
+   */
+  static void load( const std::string& prefix );
+
+private:
+  static std::string get_filename_( const std::string& prefix, const int rank );
+};
+
+} // namespace nest
+
+#endif /* #ifndef NETWORK_SNAPSHOT_H */
@@ -241,6 +241,12 @@ Node::handle( WeightRecorderEvent& )
   throw UnexpectedEvent( "The target node does not handle weight recorder events." );
 }
 
+void
+Node::record_weight( const index, const index, const rport, const port, Time const&, const double )
+{
+  throw UnexpectedEvent( "The target node does not handle weight recorder events." );
+}
+
 port
 Node::handles_test_event( WeightRecorderEvent&, rport )
 {
@@ -422,7 +428,7 @@ Node::get_K_values( double, double&, double&, double& )
 }
 
 void
-nest::Node::get_history( double, double, std::deque< histentry >::iterator*, std::deque< histentry >::iterator* )
+nest::Node::get_history( double, double, HistoryBuffer< histentry >::iterator*, HistoryBuffer< histentry >::iterator* )
 {
   throw UnexpectedEvent();
 }
@@ -430,8 +436,8 @@ nest::Node::get_history( double, double, std::deque< histentry >::iterator*, std
 void
 nest::Node::get_LTP_history( double,
   double,
-  std::deque< histentry_extended >::iterator*,
-  std::deque< histentry_extended >::iterator* )
+  HistoryBuffer< histentry_extended >::iterator*,
+  HistoryBuffer< histentry_extended >::iterator* )
 {
   throw UnexpectedEvent();
 }
@@ -439,8 +445,8 @@ nest::Node::get_LTP_history( double,
 void
 nest::Node::get_urbanczik_history( double,
   double,
-  std::deque< histentry_extended >::iterator*,
-  std::deque< histentry_extended >::iterator*,
+  HistoryBuffer< histentry_extended >::iterator*,
+  HistoryBuffer< histentry_extended >::iterator*,
   int )
 {
   throw UnexpectedEvent();
@@ -34,6 +34,7 @@
 // Includes from nestkernel:
 #include "event.h"
 #include "histentry.h"
+#include "history_buffer.h"
 #include "nest_names.h"
 #include "nest_time.h"
 #include "nest_types.h"
@@ -52,6 +53,7 @@ namespace nest
 {
 class Model;
 class ArchivingNode;
+class NodeBatch;
 class TimeConverter;
 
 
@@ -319,6 +321,21 @@ public:
    */
   virtual bool wfr_update( Time const&, const long, const long );
 
+  /**
+   * Returns true if the node can be updated in a NodeBatch together with
+   * other nodes of its model.
+   *
+   * This may depend on the parameters of the node and is checked at the
+   * beginning of each call to Run.
+   */
+  virtual bool supports_batch_update() const;
+
+  /**
+   * Create an empty batch for nodes of the model of this node. Only called
+   * if supports_batch_update() returns true.
+   */
+  virtual NodeBatch* create_batch() const;
+
   /**
    * @defgroup status_interface Configuration interface.
    * Functions and infrastructure, responsible for the configuration
@@ -480,6 +497,23 @@ public:
    */
   virtual void handle( WeightRecorderEvent& e );
 
+  /**
+   * Record the weight of a connection that has just transmitted an event.
+   *
+   * Connector::send_weight_event() calls this function of the weight
+   * recorder on its own thread instead of sending a WeightRecorderEvent.
+   * This function has to be implemented if a Node should accept weights
+   * for recording.
+   * @see class weight_recorder
+   * @ingroup event_interface
+   */
+  virtual void record_weight( const index sender_node_id,
+    const index target_node_id,
+    const rport receptor,
+    const port p,
+    Time const& stamp,
+    const double weight );
+
   /**
    * Handler for rate events.
    * @see handle(SpikeEvent&)
@@ -671,19 +705,19 @@ public:
    */
   virtual void get_history( double t1,
     double t2,
-    std::deque< histentry >::iterator* start,
-    std::deque< histentry >::iterator* finish );
+    HistoryBuffer< histentry >::iterator* start,
+    HistoryBuffer< histentry >::iterator* finish );
 
   // for Clopath synapse
   virtual void get_LTP_history( double t1,
     double t2,
-    std::deque< histentry_extended >::iterator* start,
-    std::deque< histentry_extended >::iterator* finish );
+    HistoryBuffer< histentry_extended >::iterator* start,
+    HistoryBuffer< histentry_extended >::iterator* finish );
   // for Urbanczik synapse
   virtual void get_urbanczik_history( double t1,
     double t2,
-    std::deque< histentry_extended >::iterator* start,
-    std::deque< histentry_extended >::iterator* finish,
+    HistoryBuffer< histentry_extended >::iterator* start,
+    HistoryBuffer< histentry_extended >::iterator* finish,
     int );
   // make neuron parameters accessible in Urbanczik synapse
   virtual double get_C_m( int comp );
@@ -929,6 +963,18 @@ Node::set_node_uses_wfr( const bool uwfr )
   node_uses_wfr_ = uwfr;
 }
 
+inline bool
+Node::supports_batch_update() const
+{
+  return false;
+}
+
+inline NodeBatch*
+Node::create_batch() const
+{
+  return 0;
+}
+
 inline bool
 Node::has_proxies() const
 {
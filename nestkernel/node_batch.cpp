@@ -0,0 +1,150 @@
+/*
+ *  node_batch.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "node_batch.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+
+// Includes from nestkernel:
+#include "archiving_node.h"
+#include "event.h"
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+
+namespace nest
+{
+
+NodeBatch::NodeBatch( const size_t num_arrays, const size_t num_input_channels )
+  : num_arrays_( num_arrays )
+  , num_input_channels_( num_input_channels )
+  , array_stride_( 0 )
+  , input_stride_( 0 )
+  , num_lags_( 0 )
+{
+}
+
+void
+NodeBatch::gather()
+{
+  const size_t n_nodes = nodes_.size();
+
+  // Arrays whose distance is a multiple of 4096 bytes map to the same cache
+  // sets, which the loops over all arrays would thrash. Arrays of more than
+  // a few cache lines are therefore offset by one cache line against each
+  // other.
+  array_stride_ = ( n_nodes + 7 ) / 8 * 8;
+  if ( array_stride_ >= 64 )
+  {
+    array_stride_ = ( n_nodes + 511 ) / 512 * 512 + 8;
+  }
+  input_stride_ = block_size_ + 8;
+  num_lags_ = kernel().connection_manager.get_min_delay();
+
+  array_data_.resize( num_arrays_ * array_stride_ );
+  input_data_.resize( num_input_channels_ * num_lags_ * input_stride_ );
+  spike_mask_.resize( block_size_ );
+  spiking_.resize( block_size_ );
+
+  for ( size_t i = 0; i < n_nodes; ++i )
+  {
+    load_( i );
+  }
+}
+
+void
+NodeBatch::update( Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t n_nodes = nodes_.size();
+  std::vector< size_t >::const_iterator next_logged = logged_.begin();
+  for ( size_t begin = 0; begin < n_nodes; begin += block_size_ )
+  {
+    const size_t end = std::min( begin + static_cast< size_t >( block_size_ ), n_nodes );
+    std::vector< size_t >::const_iterator end_logged = next_logged;
+    while ( end_logged != logged_.end() and *end_logged < end )
+    {
+      ++end_logged;
+    }
+
+    read_input_( begin, end, from, to );
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      step_( begin, end, lag );
+      send_spikes_( origin, lag, begin, end );
+
+      for ( std::vector< size_t >::const_iterator i = next_logged; i != end_logged; ++i )
+      {
+        store_( *i );
+        record_( *i, origin.get_steps() + lag );
+      }
+    }
+
+    next_logged = end_logged;
+  }
+}
+
+void
+NodeBatch::scatter()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+  }
+}
+
+void
+NodeBatch::send_spikes_( Time const& origin, const long lag, const size_t begin, const size_t end )
+{
+  // branch-free compaction: every index is written, but only indices of
+  // spiking nodes are kept
+  size_t n_spiking = 0;
+  for ( size_t j = 0; j < end - begin; ++j )
+  {
+    spiking_[ n_spiking ] = begin + j;
+    n_spiking += spike_mask_[ j ] != 0;
+  }
+
+  if ( n_spiking == 0 )
+  {
+    return;
+  }
+
+  const Time spike_time = Time::step( origin.get_steps() + lag + 1 );
+  for ( size_t k = 0; k < n_spiking; ++k )
+  {
+    ArchivingNode* node = static_cast< ArchivingNode* >( nodes_[ spiking_[ k ] ] );
+    for ( unsigned char s = 0; s < spike_mask_[ spiking_[ k ] - begin ]; ++s )
+    {
+      node->set_spiketime( spike_time );
+
+      SpikeEvent se;
+      kernel().event_delivery_manager.send( *node, se, lag );
+    }
+  }
+}
+
+} // namespace nest
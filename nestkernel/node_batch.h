@@ -0,0 +1,178 @@
+/*
+ *  node_batch.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NODE_BATCH_H
+#define NODE_BATCH_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+#include "nest_types.h"
+
+namespace nest
+{
+
+class Node;
+
+/**
+ * Base class for updating a group of nodes of the same model together.
+ *
+ * If the kernel property vectorized_update is set, the SimulationManager
+ * collects nodes that are consecutive in the update schedule of a thread,
+ * belong to the same model and for which Node::supports_batch_update()
+ * returns true into a batch created by Node::create_batch(). The kernel
+ * property group_nodes_by_model orders the schedule by model, so that all
+ * such nodes of a model on a thread form one batch. Derived classes keep parameters and state of
+ * their nodes as arrays over the nodes, so that each step of the update can
+ * be done for all nodes in loops the compiler can vectorize.
+ *
+ * At the beginning of each call to Run, gather() copies parameters and state
+ * from the nodes into the batch, and at the end scatter() writes the state
+ * back. In between, the state in the nodes is not up to date and the batch
+ * writes the state of a node back before recording from it.
+ *
+ * All arrays of a batch are kept in one allocation. The nodes are updated
+ * in blocks small enough for their part of the arrays to stay in cache while
+ * the block is advanced through all steps of the time slice.
+ * Spikes are sent in the order of the nodes for each step, so that they are
+ * delivered to neurons in the same order as with the update of individual
+ * nodes. Devices receive spikes when they are sent and thus see the spikes
+ * of a time slice in a different order.
+ */
+class NodeBatch
+{
+public:
+  /**
+   * Create a batch with the given number of arrays over the nodes and
+   * input channels.
+   */
+  NodeBatch( const size_t num_arrays, const size_t num_input_channels );
+
+  virtual ~NodeBatch()
+  {
+  }
+
+  void
+  add_node( Node* node )
+  {
+    nodes_.push_back( node );
+  }
+
+  size_t
+  size() const
+  {
+    return nodes_.size();
+  }
+
+  /**
+   * Copy parameters and state from the nodes into the batch.
+   */
+  void gather();
+
+  /**
+   * Update all nodes of the batch, see Node::update(). The nodes must be
+   * derived from ArchivingNode.
+   */
+  void update( Time const&, const long, const long );
+
+  /**
+   * Write the state of all nodes back from the batch to the nodes.
+   */
+  void scatter();
+
+protected:
+  //! Number of nodes updated together through all steps of a time slice
+  static const size_t block_size_ = 64;
+
+  /**
+   * Copy parameters and state of node i into the arrays and add i to
+   * logged_ if a multimeter is connected to the node.
+   */
+  virtual void load_( const size_t i ) = 0;
+
+  //! Write the state of node i back from the arrays to the node
+  virtual void store_( const size_t i ) = 0;
+
+  /**
+   * Read and reset the input of nodes [begin, end) for steps [from, to) of
+   * the current time slice into input_().
+   */
+  virtual void read_input_( const size_t begin, const size_t end, const long from, const long to ) = 0;
+
+  /**
+   * Advance nodes [begin, end) by one step and set spike_mask_[ i - begin ]
+   * to the number of spikes of node i in this step.
+   */
+  virtual void step_( const size_t begin, const size_t end, const long lag ) = 0;
+
+  //! Record data of node i, whose state has been stored, at the given step
+  virtual void record_( const size_t i, const long step ) = 0;
+
+  //! Array a over all nodes
+  double*
+  array_( const size_t a )
+  {
+    return &array_data_[ a * array_stride_ ];
+  }
+
+  //! Input on the given channel at the given lag, indexed by position in the current block
+  double*
+  input_( const size_t channel, const long lag )
+  {
+    return &input_data_[ ( channel * num_lags_ + lag ) * input_stride_ ];
+  }
+
+  std::vector< Node* > nodes_;
+
+  //! Indices of nodes with connected multimeters, in increasing order
+  std::vector< size_t > logged_;
+
+  //! Number of spikes of the nodes of the current block in the current step
+  std::vector< unsigned char > spike_mask_;
+
+private:
+  /**
+   * Record and send the spikes counted in spike_mask_ at the given lag for
+   * all nodes in [begin, end).
+   */
+  void send_spikes_( Time const& origin, const long lag, const size_t begin, const size_t end );
+
+  const size_t num_arrays_;
+  const size_t num_input_channels_;
+
+  //! Distance between arrays, padded so that arrays do not share cache sets
+  size_t array_stride_;
+  size_t input_stride_;
+  size_t num_lags_;
+
+  std::vector< double > array_data_;
+  std::vector< double > input_data_;
+
+  //! Indices of nodes that spiked in the current step
+  std::vector< size_t > spiking_;
+};
+
+} // namespace nest
+
+#endif /* #ifndef NODE_BATCH_H */
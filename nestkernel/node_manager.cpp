@@ -23,6 +23,7 @@
 #include "node_manager.h"
 
 // C++ includes:
+#include <algorithm>
 #include <set>
 
 // Includes from libnestutil:
@@ -50,6 +51,11 @@ NodeManager::NodeManager()
   , wfr_nodes_vec_()
   , wfr_is_used_( false )
   , wfr_network_size_( 0 ) // zero to force update
+  , update_schedule_()
+  , group_nodes_by_model_( false )
+  , propagator_cache_()
+  , input_buffer_arenas_()
+  , input_buffer_layout_( InputBufferArena::Layout::INDIVIDUAL )
   , num_active_nodes_( 0 )
   , num_thread_local_devices_()
   , have_nodes_changed_( true )
@@ -69,6 +75,11 @@ NodeManager::initialize()
   // explicitly force construction of wfr_nodes_vec_ to ensure consistent state
   wfr_network_size_ = 0;
   local_nodes_.resize( kernel().vp_manager.get_num_threads() );
+  update_schedule_.clear();
+  update_schedule_.resize( kernel().vp_manager.get_num_threads() );
+  propagator_cache_.initialize( kernel().vp_manager.get_num_threads() );
+  input_buffer_arenas_.clear();
+  input_buffer_arenas_.resize( kernel().vp_manager.get_num_threads() );
   num_thread_local_devices_.resize( kernel().vp_manager.get_num_threads(), 0 );
   ensure_valid_thread_local_ids();
 
@@ -639,8 +650,24 @@ NodeManager::prepare_nodes()
     // exceptions here and then handle them after the parallel region.
     try
     {
+      // propagators of neurons are looked up anew during calibration, so that
+      // the cache only keeps entries for the current parameters
+      propagator_cache_.clear( t );
+
+      // buffers cleared during initialization of the nodes register with the
+      // arena, which then lays them out in memory allocated by this thread
+      if ( input_buffer_layout_ != InputBufferArena::Layout::INDIVIDUAL )
+      {
+        input_buffer_arenas_[ t ].open( input_buffer_layout_ );
+      }
+
+      std::vector< Node* >& schedule = update_schedule_[ t ];
+      schedule.clear();
+      schedule.reserve( local_nodes_[ t ].size() );
+
       for ( SparseNodeArray::const_iterator it = local_nodes_[ t ].begin(); it != local_nodes_[ t ].end(); ++it )
       {
+        schedule.push_back( it->get_node() );
         prepare_node_( ( it )->get_node() );
         if ( not( it->get_node() )->is_frozen() )
         {
@@ -651,6 +678,22 @@ NodeManager::prepare_nodes()
           }
         }
       }
+
+      // Updating the nodes of one model in sequence keeps the code and
+      // branch history of the model's update in cache. The order in which
+      // spikes are sent changes, and with it the order in which inputs are
+      // summed, so this is only done on request.
+      if ( group_nodes_by_model_ )
+      {
+        std::stable_sort( schedule.begin(),
+          schedule.end(),
+          []( const Node* a, const Node* b ) { return a->get_model_id() < b->get_model_id(); } );
+      }
+
+      if ( input_buffer_arenas_[ t ].is_open() )
+      {
+        input_buffer_arenas_[ t ].close();
+      }
     }
     catch ( std::exception& e )
     {
@@ -774,10 +817,35 @@ NodeManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::network_size, size() );
   def< double >( d, names::time_construction_create, sw_construction_create_.elapsed() );
+  def< bool >( d, names::group_nodes_by_model, group_nodes_by_model_ );
+  def< std::string >( d, names::input_buffer_layout, InputBufferArena::layout_name( input_buffer_layout_ ) );
 }
 
 void
-NodeManager::set_status( const DictionaryDatum& )
+NodeManager::set_status( const DictionaryDatum& d )
 {
+  updateValue< bool >( d, names::group_nodes_by_model, group_nodes_by_model_ );
+
+  std::string layout;
+  if ( updateValue< std::string >( d, names::input_buffer_layout, layout ) )
+  {
+    const InputBufferArena::Layout new_layout = InputBufferArena::layout_from_name( layout );
+    if ( new_layout != input_buffer_layout_ and size() > 0 )
+    {
+      throw KernelException( "input_buffer_layout cannot be changed after nodes have been created." );
+    }
+    input_buffer_layout_ = new_layout;
+  }
+}
+
+InputBufferArena*
+NodeManager::get_input_buffer_arena()
+{
+  const size_t t = kernel().vp_manager.get_thread_id();
+  if ( t >= input_buffer_arenas_.size() or not input_buffer_arenas_[ t ].is_open() )
+  {
+    return nullptr;
+  }
+  return &input_buffer_arenas_[ t ];
 }
 }
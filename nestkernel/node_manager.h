@@ -32,8 +32,10 @@
 
 // Includes from nestkernel:
 #include "conn_builder.h"
+#include "input_buffer_arena.h"
 #include "nest_types.h"
 #include "node_collection.h"
+#include "propagator_cache.h"
 #include "sparse_node_array.h"
 
 // Includes from sli:
@@ -183,9 +185,32 @@ public:
    */
   const std::vector< Node* >& get_wfr_nodes_on_thread( thread ) const;
 
+  /**
+   * Get the order in which the nodes of the given thread are updated.
+   *
+   * The schedule contains all thread-local nodes, including frozen ones,
+   * and is rebuilt by prepare_nodes(). If group_nodes_by_model is set, the
+   * nodes are ordered by model and by node ID within each model, otherwise
+   * by node ID.
+   */
+  const std::vector< Node* >& get_update_schedule( thread ) const;
+
+  /**
+   * Return the cache of propagators shared by neurons with identical
+   * parameters, see PropagatorCache.
+   */
+  PropagatorCache& get_propagator_cache();
+
+  /**
+   * Return the input buffer arena of the calling thread while nodes are
+   * prepared and input_buffer_layout is not "individual", nullptr otherwise.
+   */
+  InputBufferArena* get_input_buffer_arena();
+
   /**
    * Prepare nodes for simulation and register nodes in node_list.
-   * Calls prepare_node_() for each pertaining Node.
+   * Calls prepare_node_() for each pertaining Node and builds the update
+   * schedule of each thread.
    * @see prepare_node_()
    */
   void prepare_nodes();
@@ -302,6 +327,15 @@ private:
                                                       //!< waveform relaxation
   //! Network size when wfr_nodes_vec_ was last updated
   index wfr_network_size_;
+
+  std::vector< std::vector< Node* > > update_schedule_; //!< Order of node updates per thread
+  bool group_nodes_by_model_;                           //!< Update nodes of the same model together
+
+  PropagatorCache propagator_cache_; //!< Propagators shared by neurons, cleared by prepare_nodes()
+
+  std::vector< InputBufferArena > input_buffer_arenas_; //!< Input buffers of the nodes of each thread
+  InputBufferArena::Layout input_buffer_layout_;
+
   size_t num_active_nodes_; //!< number of nodes created by prepare_nodes
 
   std::vector< index > num_thread_local_devices_; //!< stores number of thread local devices
@@ -334,6 +368,18 @@ NodeManager::get_wfr_nodes_on_thread( thread t ) const
   return wfr_nodes_vec_.at( t );
 }
 
+inline const std::vector< Node* >&
+NodeManager::get_update_schedule( thread t ) const
+{
+  return update_schedule_[ t ];
+}
+
+inline PropagatorCache&
+NodeManager::get_propagator_cache()
+{
+  return propagator_cache_;
+}
+
 inline bool
 NodeManager::wfr_is_used() const
 {
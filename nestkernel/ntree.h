@@ -301,6 +301,11 @@ public:
    */
   std::vector< value_type > get_nodes();
 
+  /**
+   * @returns number of nodes in ntree.
+   */
+  size_t size() const;
+
   /**
    * Applies a Mask to this ntree.
    * @param mask    mask to apply.
@@ -348,6 +353,33 @@ public:
    */
   bool is_leaf() const;
 
+  /**
+   * @returns lower left corner of the region covered by the ntree.
+   */
+  const Position< D >&
+  get_lower_left() const
+  {
+    return lower_left_;
+  }
+
+  /**
+   * @returns size of the region covered by the ntree.
+   */
+  const Position< D >&
+  get_extent() const
+  {
+    return extent_;
+  }
+
+  /**
+   * @returns a bitmask specifying which directions are periodic
+   */
+  std::bitset< D >
+  get_periodic_mask() const
+  {
+    return periodic_;
+  }
+
 protected:
   /**
    * Change a leaf ntree to a regular ntree with four
@@ -450,6 +482,23 @@ Ntree< D, T, max_capacity, max_depth >::get_nodes()
   return result;
 }
 
+template < int D, class T, int max_capacity, int max_depth >
+size_t
+Ntree< D, T, max_capacity, max_depth >::size() const
+{
+  if ( leaf_ )
+  {
+    return nodes_.size();
+  }
+
+  size_t num_nodes = 0;
+  for ( int i = 0; i < N; ++i )
+  {
+    num_nodes += children_[ i ]->size();
+  }
+  return num_nodes;
+}
+
 template < int D, class T, int max_capacity, int max_depth >
 std::vector< std::pair< Position< D >, T > >
 Ntree< D, T, max_capacity, max_depth >::get_nodes( const Mask< D >& mask, const Position< D >& anchor )
@@ -0,0 +1,111 @@
+/*
+ *  propagator_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PROPAGATOR_CACHE_H
+#define PROPAGATOR_CACHE_H
+
+// C++ includes:
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Cache of propagators shared by neurons with identical parameters.
+ *
+ * Neuron models that integrate their dynamics exactly compute propagators
+ * from their parameters and the resolution in calibrate(). Models that use
+ * the cache keep these in a struct Propagators with a constructor taking the
+ * arguments needed to compute them, and obtain a shared instance with
+ *
+ *   V_.propagators_ = kernel().node_manager.get_propagator_cache().get< Propagators_ >(
+ *     get_thread(), { P_.tau_, ... }, P_ );
+ *
+ * The key passed to get() must contain every parameter the propagators
+ * depend on. Entries are distinguished by the propagator type, that is by
+ * model, and by the resolution, which is added to the key by the cache.
+ *
+ * There is one cache per thread, which is only accessed by that thread
+ * during calibration, so no locking is needed. The NodeManager clears the
+ * caches before nodes are calibrated; entries stay alive as long as a
+ * neuron refers to them.
+ */
+class PropagatorCache
+{
+public:
+  //! Resize to one cache per thread and remove all entries
+  void
+  initialize( const size_t num_threads )
+  {
+    caches_.clear();
+    caches_.resize( num_threads );
+  }
+
+  //! Remove all entries of the cache of the given thread
+  void
+  clear( const thread t )
+  {
+    caches_[ t ].clear();
+  }
+
+  /**
+   * Return the propagators for the given key, constructing them from args
+   * if they are not in the cache of thread t.
+   */
+  template < typename Propagators, typename... Args >
+  std::shared_ptr< const Propagators > get( const thread t, std::vector< double > key, const Args&... args );
+
+private:
+  typedef std::pair< std::type_index, std::vector< double > > Key_;
+
+  std::vector< std::map< Key_, std::shared_ptr< const void > > > caches_;
+};
+
+template < typename Propagators, typename... Args >
+std::shared_ptr< const Propagators >
+PropagatorCache::get( const thread t, std::vector< double > key, const Args&... args )
+{
+  key.push_back( Time::get_resolution().get_ms() );
+  Key_ full_key( std::type_index( typeid( Propagators ) ), std::move( key ) );
+
+  std::map< Key_, std::shared_ptr< const void > >& cache = caches_[ t ];
+  auto entry = cache.find( full_key );
+  if ( entry == cache.end() )
+  {
+    std::shared_ptr< const void > propagators = std::make_shared< const Propagators >( args... );
+    entry = cache.insert( std::make_pair( std::move( full_key ), std::move( propagators ) ) ).first;
+  }
+  return std::static_pointer_cast< const Propagators >( entry->second );
+}
+
+} // namespace nest
+
+#endif /* #ifndef PROPAGATOR_CACHE_H */
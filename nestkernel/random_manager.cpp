@@ -42,6 +42,7 @@ const std::string nest::RandomManager::DEFAULT_RNG_TYPE_ = "mt19937_64";
 const std::uint32_t nest::RandomManager::DEFAULT_BASE_SEED_ = 143202461;
 
 const std::uint32_t nest::RandomManager::RANK_SYNCED_SEEDER_ = 0xc229212d;
+const std::uint32_t nest::RandomManager::RANK_SPECIFIC_SEEDER_ = 0x5d8e4a91;
 const std::uint32_t nest::RandomManager::THREAD_SYNCED_SEEDER_ = 0x37722d5e;
 const std::uint32_t nest::RandomManager::THREAD_SPECIFIC_SEEDER_ = 0xb84c9bae;
 
@@ -50,6 +51,7 @@ nest::RandomManager::RandomManager()
   : current_rng_type_( DEFAULT_RNG_TYPE_ )
   , base_seed_( DEFAULT_BASE_SEED_ )
   , rank_synced_rng_( nullptr )
+  , rank_specific_rng_( nullptr )
 {
 }
 
@@ -104,6 +106,7 @@ nest::RandomManager::reset_rngs_()
 {
   // Delete existing RNGs.
   delete rank_synced_rng_;
+  delete rank_specific_rng_;
 
   auto delete_rngs = []( std::vector< RngPtr >& rng_vec ) {
     for ( auto rng : rng_vec )
@@ -117,6 +120,8 @@ nest::RandomManager::reset_rngs_()
 
   // Create new RNGs of the currently used RNG type.
   rank_synced_rng_ = rng_types_[ current_rng_type_ ]->create( { base_seed_, RANK_SYNCED_SEEDER_ } );
+  const std::uint32_t rank = kernel().mpi_manager.get_rank();
+  rank_specific_rng_ = rng_types_[ current_rng_type_ ]->create( { base_seed_, RANK_SPECIFIC_SEEDER_, rank } );
 
   vp_synced_rngs_.resize( kernel().vp_manager.get_num_threads() );
   vp_specific_rngs_.resize( kernel().vp_manager.get_num_threads() );
@@ -94,6 +94,15 @@ public:
    */
   RngPtr get_vp_specific_rng( thread tid ) const;
 
+  /**
+   * Get rank-specific random number generator.
+   *
+   * Each MPI rank has an independent random number sequence, which does not
+   * depend on the number of threads. It may be used only by one thread at a
+   * time.
+   */
+  RngPtr get_rank_specific_rng() const;
+
   /**
    * Confirm that rank- and thread-synchronized RNGs are in sync.
    *
@@ -124,6 +133,9 @@ private:
   /** Random number generator synchronized across ranks. */
   RngPtr rank_synced_rng_;
 
+  /** Random number generator specific to the rank. */
+  RngPtr rank_specific_rng_;
+
   /** Random number generators synchronized across VPs. */
   std::vector< RngPtr > vp_synced_rngs_;
 
@@ -147,6 +159,9 @@ private:
   /** Rank-synchronized seed-sequence initializer component. */
   static const std::uint32_t RANK_SYNCED_SEEDER_;
 
+  /** Rank-specific seed-sequence initializer component. */
+  static const std::uint32_t RANK_SPECIFIC_SEEDER_;
+
   /** Thread-synchronized seed-sequence initializer component. */
   static const std::uint32_t THREAD_SYNCED_SEEDER_;
 
@@ -160,6 +175,12 @@ nest::RandomManager::get_rank_synced_rng() const
   return rank_synced_rng_;
 }
 
+inline RngPtr
+nest::RandomManager::get_rank_specific_rng() const
+{
+  return rank_specific_rng_;
+}
+
 inline RngPtr
 nest::RandomManager::get_vp_synced_rng( thread tid ) const
 {
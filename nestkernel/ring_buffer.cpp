@@ -23,26 +23,20 @@
 #include "ring_buffer.h"
 
 nest::RingBuffer::RingBuffer()
-  : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(), 0.0 )
+  : buffer_( 1 )
 {
 }
 
 void
 nest::RingBuffer::resize()
 {
-  size_t size = kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay();
-  if ( buffer_.size() != size )
-  {
-    buffer_.resize( size );
-  }
+  buffer_.resize();
 }
 
 void
 nest::RingBuffer::clear()
 {
-  resize(); // does nothing if size is fine
-  // clear all elements
-  buffer_.assign( buffer_.size(), 0.0 );
+  buffer_.clear();
 }
 
 
@@ -29,6 +29,7 @@
 #include <vector>
 
 // Includes from nestkernel:
+#include "input_buffer_arena.h"
 #include "kernel_manager.h"
 #include "nest_time.h"
 #include "nest_types.h"
@@ -131,12 +132,12 @@ public:
   size_t
   size() const
   {
-    return buffer_.size();
+    return buffer_.num_slots();
   }
 
 private:
-  //! Buffered data
-  std::vector< double > buffer_;
+  //! Buffered data, in a vector of its own or in the input buffer arena of the thread
+  InputBufferStorage buffer_;
 
   /**
    * Obtain buffer index.
@@ -150,39 +151,38 @@ private:
 inline void
 RingBuffer::add_value( const long offs, const double v )
 {
-  buffer_[ get_index_( offs ) ] += v;
+  buffer_.value( get_index_( offs ), 0 ) += v;
 }
 
 inline void
 RingBuffer::set_value( const long offs, const double v )
 {
-  buffer_[ get_index_( offs ) ] = v;
+  buffer_.value( get_index_( offs ), 0 ) = v;
 }
 
 inline double
 RingBuffer::get_value( const long offs )
 {
-  assert( 0 <= offs and ( size_t ) offs < buffer_.size() );
+  assert( 0 <= offs and ( size_t ) offs < buffer_.num_slots() );
   assert( ( delay ) offs < kernel().connection_manager.get_min_delay() );
 
   // offs == 0 is beginning of slice, but we have to
   // take modulo into account when indexing
-  long idx = get_index_( offs );
-  double val = buffer_[ idx ];
-  buffer_[ idx ] = 0.0; // clear buffer after reading
+  double& value = buffer_.value( get_index_( offs ), 0 );
+  double val = value;
+  value = 0.0; // clear buffer after reading
   return val;
 }
 
 inline double
 RingBuffer::get_value_wfr_update( const long offs )
 {
-  assert( 0 <= offs and ( size_t ) offs < buffer_.size() );
+  assert( 0 <= offs and ( size_t ) offs < buffer_.num_slots() );
   assert( ( delay ) offs < kernel().connection_manager.get_min_delay() );
 
   // offs == 0 is beginning of slice, but we have to
   // take modulo into account when indexing
-  long idx = get_index_( offs );
-  double val = buffer_[ idx ];
+  double val = buffer_.value( get_index_( offs ), 0 );
   return val;
 }
 
@@ -191,7 +191,7 @@ RingBuffer::get_index_( const delay d ) const
 {
   const long idx = kernel().event_delivery_manager.get_modulo( d );
   assert( 0 <= idx );
-  assert( ( size_t ) idx < buffer_.size() );
+  assert( ( size_t ) idx < buffer_.num_slots() );
   return idx;
 }
 
@@ -362,7 +362,8 @@ public:
 
   void add_value( const index slot, const index channel, const double value );
 
-  const std::array< double, num_channels >& get_values_all_channels( const index slot ) const;
+  //! Values of all channels of the given slot, indexed by channel
+  const double* get_values_all_channels( const index slot ) const;
   void reset_values_all_channels( const index slot );
 
   void clear();
@@ -373,41 +374,45 @@ public:
 
 private:
   /**
-   * Buffered data stored in a vector of arrays of double values
-   * 1st dimension: ring buffer slot (index into outer vector)
-   * 2nd dimension: channel (index into inner array)
+   * Buffered data, in a vector of its own or in the input buffer arena of
+   * the thread
+   * 1st dimension: ring buffer slot
+   * 2nd dimension: channel
    */
-  std::vector< std::array< double, num_channels > > buffer_;
+  InputBufferStorage buffer_;
 };
 
 template < unsigned int num_channels >
 inline void
 MultiChannelInputBuffer< num_channels >::reset_values_all_channels( const index slot )
 {
-  assert( slot < buffer_.size() );
-  buffer_[ slot ].fill( 0.0 );
+  assert( slot < buffer_.num_slots() );
+  for ( index channel = 0; channel < num_channels; ++channel )
+  {
+    buffer_.value( slot, channel ) = 0.0;
+  }
 }
 
 template < unsigned int num_channels >
 inline void
 MultiChannelInputBuffer< num_channels >::add_value( const index slot, const index channel, const double value )
 {
-  buffer_[ slot ][ channel ] += value;
+  buffer_.value( slot, channel ) += value;
 }
 
 template < unsigned int num_channels >
-inline const std::array< double, num_channels >&
+inline const double*
 MultiChannelInputBuffer< num_channels >::get_values_all_channels( const index slot ) const
 {
-  assert( slot < buffer_.size() );
-  return buffer_[ slot ];
+  assert( slot < buffer_.num_slots() );
+  return buffer_.values( slot );
 }
 
 template < unsigned int num_channels >
 inline size_t
 MultiChannelInputBuffer< num_channels >::size() const
 {
-  return buffer_.size();
+  return buffer_.num_slots();
 }
 
 } // namespace nest
@@ -27,8 +27,7 @@
 
 template < unsigned int num_channels >
 nest::MultiChannelInputBuffer< num_channels >::MultiChannelInputBuffer()
-  : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(),
-    std::array< double, num_channels >() )
+  : buffer_( num_channels )
 {
 }
 
@@ -36,23 +35,14 @@ template < unsigned int num_channels >
 void
 nest::MultiChannelInputBuffer< num_channels >::resize()
 {
-  const size_t size = kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay();
-  if ( buffer_.size() != size )
-  {
-    buffer_.resize( size, std::array< double, num_channels >() );
-  }
+  buffer_.resize();
 }
 
 template < unsigned int num_channels >
 void
 nest::MultiChannelInputBuffer< num_channels >::clear()
 {
-  resize(); // does nothing if size is fine
-  // set all elements to 0.0
-  for ( index slot = 0; slot < buffer_.size(); ++slot )
-  {
-    reset_values_all_channels( slot );
-  }
+  buffer_.clear();
 }
 
 #endif
@@ -37,6 +37,7 @@
 #include "connection_manager_impl.h"
 #include "event_delivery_manager.h"
 #include "kernel_manager.h"
+#include "node_batch.h"
 
 // Includes from sli:
 #include "dictutils.h"
@@ -59,6 +60,8 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , vectorized_update_( false )
+  , lazy_update_( false )
   , update_time_limit_( std::numeric_limits< double >::infinity() )
   , min_update_time_( std::numeric_limits< double >::infinity() )
   , max_update_time_( -std::numeric_limits< double >::infinity() )
@@ -380,6 +383,9 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
     }
   }
 
+  updateValue< bool >( d, names::vectorized_update, vectorized_update_ );
+  updateValue< bool >( d, names::lazy_update, lazy_update_ );
+
   // update time limit
   double t_new = 0.0;
   if ( updateValue< double >( d, names::update_time_limit, t_new ) )
@@ -415,6 +421,9 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< long >( d, names::wfr_max_iterations, wfr_max_iterations_ );
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
 
+  def< bool >( d, names::vectorized_update, vectorized_update_ );
+  def< bool >( d, names::lazy_update, lazy_update_ );
+
   def< double >( d, names::update_time_limit, update_time_limit_ );
   def< double >( d, names::min_update_time, min_update_time_ );
   def< double >( d, names::max_update_time, max_update_time_ );
@@ -598,6 +607,7 @@ nest::SimulationManager::run( Time const& t )
 
   call_update_();
 
+  kernel().node_manager.post_run_cleanup();
   kernel().io_manager.post_run_hook();
   kernel().random_manager.check_rng_synchrony();
 
@@ -784,6 +794,13 @@ nest::SimulationManager::update_()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
 
+    std::vector< std::pair< Node*, NodeBatch* > > schedule;
+    std::vector< std::unique_ptr< NodeBatch > > batches;
+    if ( vectorized_update_ )
+    {
+      create_node_batches_( tid, schedule, batches );
+    }
+
     do
     {
       if ( print_time_ )
@@ -804,9 +821,14 @@ nest::SimulationManager::update_()
           node->update_synaptic_elements( Time( Time::step( clock_.get_steps() + from_step_ ) ).get_ms() );
         }
 #pragma omp barrier
-#pragma omp single
+        try
         {
-          kernel().sp_manager.update_structural_plasticity();
+          kernel().sp_manager.update_structural_plasticity( tid );
+        }
+        catch ( std::exception& e )
+        {
+          // all threads throw alike, so throw the exception after parallel region
+          exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
         }
         // Remove 10% of the vacant elements
         for ( SparseNodeArray::const_iterator i = kernel().node_manager.get_local_nodes( tid ).begin();
@@ -820,8 +842,11 @@ nest::SimulationManager::update_()
         // after structural plasticity has created and deleted
         // connections, update the connection infrastructure; implies
         // complete removal of presynaptic part and reconstruction
-        // from postsynaptic data
-        update_connection_infrastructure( tid );
+        // from postsynaptic data. The flag is the same on all ranks.
+        if ( kernel().connection_manager.connections_have_changed() )
+        {
+          update_connection_infrastructure( tid );
+        }
 
       } // of structural plasticity
 
@@ -949,24 +974,48 @@ nest::SimulationManager::update_()
         sw_update_.start();
       }
 #endif
-      const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
-
-      for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+      if ( vectorized_update_ )
       {
-        // We update in a parallel region. Therefore, we need to catch
-        // exceptions here and then handle them after the parallel region.
-        try
+        for ( auto entry = schedule.begin(); entry != schedule.end(); ++entry )
         {
-          Node* node = n->get_node();
-          if ( not( node )->is_frozen() )
+          try
           {
-            ( node )->update( clock_, from_step_, to_step_ );
+            if ( entry->second )
+            {
+              entry->second->update( clock_, from_step_, to_step_ );
+            }
+            else if ( not entry->first->is_frozen() )
+            {
+              entry->first->update( clock_, from_step_, to_step_ );
+            }
+          }
+          catch ( std::exception& e )
+          {
+            exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
           }
         }
-        catch ( std::exception& e )
+      }
+      else
+      {
+        const std::vector< Node* >& schedule = kernel().node_manager.get_update_schedule( tid );
+
+        for ( std::vector< Node* >::const_iterator n = schedule.begin(); n != schedule.end(); ++n )
         {
-          // so throw the exception after parallel region
-          exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
+          // We update in a parallel region. Therefore, we need to catch
+          // exceptions here and then handle them after the parallel region.
+          try
+          {
+            Node* node = *n;
+            if ( not( node )->is_frozen() )
+            {
+              ( node )->update( clock_, from_step_, to_step_ );
+            }
+          }
+          catch ( std::exception& e )
+          {
+            // so throw the exception after parallel region
+            exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
+          }
         }
       }
 
@@ -1040,6 +1089,13 @@ nest::SimulationManager::update_()
 
     } while ( to_do_ > 0 and not update_time_limit_exceeded and not exceptions_raised.at( tid ) );
 
+    // write the state of batched nodes back, so that it can be inspected
+    // and the nodes can be updated individually in the next call
+    for ( auto batch = batches.begin(); batch != batches.end(); ++batch )
+    {
+      ( *batch )->scatter();
+    }
+
     // End of the slice, we update the number of synaptic elements
     for ( SparseNodeArray::const_iterator i = kernel().node_manager.get_local_nodes( tid ).begin();
           i != kernel().node_manager.get_local_nodes( tid ).end();
@@ -1069,6 +1125,45 @@ nest::SimulationManager::update_()
   }
 }
 
+void
+nest::SimulationManager::create_node_batches_( const thread tid,
+  std::vector< std::pair< Node*, NodeBatch* > >& schedule,
+  std::vector< std::unique_ptr< NodeBatch > >& batches )
+{
+  const std::vector< Node* >& update_schedule = kernel().node_manager.get_update_schedule( tid );
+  schedule.reserve( update_schedule.size() );
+
+  NodeBatch* batch = 0;
+  int batch_model_id = -1;
+  for ( std::vector< Node* >::const_iterator n = update_schedule.begin(); n != update_schedule.end(); ++n )
+  {
+    Node* node = *n;
+    if ( node->is_frozen() or not node->supports_batch_update() )
+    {
+      schedule.push_back( std::make_pair( node, static_cast< NodeBatch* >( 0 ) ) );
+      batch = 0;
+      continue;
+    }
+
+    // only consecutive nodes of the update schedule are batched, so that
+    // spikes are emitted in the same order as with individual updates; if
+    // group_nodes_by_model is set, this typically yields one batch per model
+    if ( not batch or node->get_model_id() != batch_model_id )
+    {
+      batches.push_back( std::unique_ptr< NodeBatch >( node->create_batch() ) );
+      batch = batches.back().get();
+      batch_model_id = node->get_model_id();
+      schedule.push_back( std::make_pair( static_cast< Node* >( 0 ), batch ) );
+    }
+    batch->add_node( node );
+  }
+
+  for ( auto b = batches.begin(); b != batches.end(); ++b )
+  {
+    ( *b )->gather();
+  }
+}
+
 void
 nest::SimulationManager::advance_time_()
 {
@@ -27,6 +27,8 @@
 #include <sys/time.h>
 
 // C++ includes:
+#include <memory>
+#include <utility>
 #include <vector>
 
 // Includes from libnestutil:
@@ -43,6 +45,7 @@
 namespace nest
 {
 class Node;
+class NodeBatch;
 
 class SimulationManager : public ManagerInterface
 {
@@ -91,6 +94,12 @@ public:
    */
   bool use_wfr() const;
 
+  /**
+   * Returns true if neurons that support it may skip updates while they
+   * receive no input and cannot spike, see kernel property lazy_update.
+   */
+  bool lazy_update() const;
+
   /**
    * Get the desired communication interval for the waveform relaxation
    */
@@ -187,6 +196,18 @@ private:
   void call_update_(); //!< actually run simulation, aka wrap update_
   void update_();      //! actually perform simulation
   bool wfr_update_( Node* );
+
+  /**
+   * Collect consecutive nodes on the thread that can be updated together into
+   * batches.
+   *
+   * The schedule lists, in the order of the update schedule of the node
+   * manager, either a single node to be updated on its own, or a batch. The
+   * batches are gathered.
+   */
+  void create_node_batches_( const thread,
+    std::vector< std::pair< Node*, NodeBatch* > >& schedule,
+    std::vector< std::unique_ptr< NodeBatch > >& batches );
   void advance_time_();   //!< Update time to next time step
   void print_progress_(); //!< TODO: Remove, replace by logging!
 
@@ -216,6 +237,8 @@ private:
                                    //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+  bool vectorized_update_;         //!< Update nodes that support it in batches
+  bool lazy_update_;               //!< Skip updates of quiescent neurons that support it
   double update_time_limit_;       //!< throw exception if single update cycle takes longer
                                    //!< than update_time_limit_ (seconds, default inf)
   double min_update_time_;         //!< shortest update time seen so far (seconds)
@@ -307,6 +330,12 @@ SimulationManager::use_wfr() const
   return use_wfr_;
 }
 
+inline bool
+SimulationManager::lazy_update() const
+{
+  return lazy_update_;
+}
+
 inline double
 SimulationManager::get_wfr_comm_interval() const
 {
@@ -23,6 +23,7 @@
 #include "slice_ring_buffer.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -69,7 +70,88 @@ nest::SliceRingBuffer::prepare_delivery()
   deliver_ = &( queue_[ kernel().event_delivery_manager.get_slice_modulo( 0 ) ] );
 
   // sort events, first event last
-  std::sort( deliver_->begin(), deliver_->end(), std::greater< SpikeInfo >() );
+  sort_for_delivery( *deliver_, sort_buffer_, sort_counts_ );
+}
+
+void
+nest::SliceRingBuffer::sort_for_delivery( std::vector< SpikeInfo >& spikes,
+  std::vector< SpikeInfo >& buffer,
+  std::vector< size_t >& counts )
+{
+  const size_t n = spikes.size();
+  if ( n <= max_insertion_sort_size_ )
+  {
+    insertion_sort_( spikes, 0, n );
+    return;
+  }
+
+  long min_stamp = spikes[ 0 ].stamp_;
+  long max_stamp = spikes[ 0 ].stamp_;
+  for ( const SpikeInfo& spike : spikes )
+  {
+    min_stamp = std::min( min_stamp, spike.stamp_ );
+    max_stamp = std::max( max_stamp, spike.stamp_ );
+  }
+
+  // stamps of a slice span at most min_delay steps, so this only applies
+  // to few spikes in a long slice
+  const size_t num_buckets = max_stamp - min_stamp + 1;
+  if ( num_buckets > 2 * n + 16 )
+  {
+    std::stable_sort( spikes.begin(), spikes.end(), std::greater< SpikeInfo >() );
+    return;
+  }
+
+  counts.assign( num_buckets + 1, 0 );
+  for ( const SpikeInfo& spike : spikes )
+  {
+    ++counts[ max_stamp - spike.stamp_ + 1 ];
+  }
+
+  // counts[ b ] becomes the start of bucket b, latest stamp first
+  for ( size_t b = 1; b <= num_buckets; ++b )
+  {
+    counts[ b ] += counts[ b - 1 ];
+  }
+
+  buffer.resize( n, spikes[ 0 ] );
+  for ( const SpikeInfo& spike : spikes )
+  {
+    buffer[ counts[ max_stamp - spike.stamp_ ]++ ] = spike;
+  }
+
+  // counts[ b ] is now the end of bucket b; sort each bucket by offset
+  size_t begin = 0;
+  for ( size_t b = 0; b < num_buckets; ++b )
+  {
+    const size_t end = counts[ b ];
+    if ( end - begin > max_insertion_sort_size_ )
+    {
+      std::stable_sort( buffer.begin() + begin, buffer.begin() + end, std::greater< SpikeInfo >() );
+    }
+    else
+    {
+      insertion_sort_( buffer, begin, end );
+    }
+    begin = end;
+  }
+
+  spikes.swap( buffer );
+}
+
+void
+nest::SliceRingBuffer::insertion_sort_( std::vector< SpikeInfo >& spikes, const size_t begin, const size_t end )
+{
+  for ( size_t i = begin + 1; i < end; ++i )
+  {
+    const SpikeInfo spike = spikes[ i ];
+    size_t j = i;
+    for ( ; j > begin and spikes[ j - 1 ] < spike; --j )
+    {
+      spikes[ j ] = spikes[ j - 1 ];
+    }
+    spikes[ j ] = spike;
+  }
 }
 
 void
@@ -45,6 +45,10 @@ namespace nest
  * one by one in correct temporal order.  Coinciding spikes
  * are combined into one, see get_next_spike().
  *
+ * Since the spikes of a slice fall into at most min_delay steps, they are
+ * sorted by a counting sort on their stamps followed by an insertion sort
+ * by offset within each step, see sort_for_delivery().
+ *
  * Data is organized as follows:
  * - The time of the next return from refractoriness is
  *   stored in a separate variable and checked explicitly;
@@ -122,7 +126,6 @@ public:
    */
   void resize();
 
-private:
   /**
    * Information about spike.
    */
@@ -141,12 +144,40 @@ private:
     double weight_;    //<! spike weight
   };
 
+  /**
+   * Sort spikes in descending order, so that the first spike is last.
+   *
+   * Few spikes are sorted by insertion. Otherwise, if the stamps span a
+   * range not much larger than the number of spikes, spikes are distributed
+   * to one bucket per stamp by a counting sort and each bucket is sorted by
+   * offset, by insertion unless it is large. Otherwise, spikes are sorted
+   * with std::stable_sort. Spikes with equal stamp and offset keep their
+   * order of arrival.
+   *
+   * @param spikes   Spikes to sort
+   * @param buffer   Scratch space, swapped with spikes
+   * @param counts   Scratch space for bucket counts
+   */
+  static void
+  sort_for_delivery( std::vector< SpikeInfo >& spikes, std::vector< SpikeInfo >& buffer, std::vector< size_t >& counts );
+
+private:
+  //! Sort spikes in [begin, end) in descending order, keeping the order of equal spikes
+  static void insertion_sort_( std::vector< SpikeInfo >& spikes, const size_t begin, const size_t end );
+
+  //! Largest number of spikes sorted by insertion
+  static const size_t max_insertion_sort_size_ = 32;
+
   //! entire queue, one slot per min_delay block within max_delay
   std::vector< std::vector< SpikeInfo > > queue_;
 
   //! slot to deliver from
   std::vector< SpikeInfo >* deliver_;
 
+  //! scratch space for sort_for_delivery()
+  std::vector< SpikeInfo > sort_buffer_;
+  std::vector< size_t > sort_counts_;
+
   SpikeInfo refract_; //!< pseudo-event for return from refractoriness
 };
 
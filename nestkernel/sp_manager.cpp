@@ -38,7 +38,9 @@
 #include "connector_base.h"
 #include "connector_model.h"
 #include "kernel_manager.h"
+#include "mpi_manager_impl.h"
 #include "nest_names.h"
+#include "vp_manager_impl.h"
 
 namespace nest
 {
@@ -59,9 +61,18 @@ SPManager::SPManager()
   : ManagerInterface()
   , structural_plasticity_update_interval_( 10000. )
   , structural_plasticity_enabled_( false )
+  , structural_plasticity_point_to_point_( false )
   , sp_conn_builders_()
   , growthcurve_factories_()
   , growthcurvedict_( new Dictionary() )
+  , deleted_sources_()
+  , deleted_targets_()
+  , new_sources_()
+  , new_targets_()
+  , synapses_changed_( false )
+  , exceptions_raised_()
+  , calcium_trace_buffers_()
+  , growth_buffers_()
 {
 }
 
@@ -75,6 +86,16 @@ SPManager::initialize()
 {
   structural_plasticity_update_interval_ = 10000.;
   structural_plasticity_enabled_ = false;
+  structural_plasticity_point_to_point_ = false;
+  calcium_trace_buffers_.resize( kernel().vp_manager.get_num_threads() );
+  growth_buffers_.resize( kernel().vp_manager.get_num_threads() );
+}
+
+void
+SPManager::change_number_of_threads()
+{
+  calcium_trace_buffers_.resize( kernel().vp_manager.get_num_threads() );
+  growth_buffers_.resize( kernel().vp_manager.get_num_threads() );
 }
 
 void
@@ -110,6 +131,7 @@ SPManager::get_status( DictionaryDatum& d )
   }
 
   def< double >( d, names::structural_plasticity_update_interval, structural_plasticity_update_interval_ );
+  def< bool >( d, names::structural_plasticity_point_to_point, structural_plasticity_point_to_point_ );
 
   ArrayDatum growth_curves;
   for ( auto const& element : *growthcurvedict_ )
@@ -131,6 +153,7 @@ SPManager::set_status( const DictionaryDatum& d )
   {
     updateValue< double >( d, names::structural_plasticity_update_interval, structural_plasticity_update_interval_ );
   }
+  updateValue< bool >( d, names::structural_plasticity_point_to_point, structural_plasticity_point_to_point_ );
   if ( not d->known( names::structural_plasticity_synapses ) )
   {
     return;
@@ -205,7 +228,8 @@ SPManager::builder_max_delay() const
 }
 
 /**
- * Deletes synapses between a source and a target.
+ * Deletes synapses between a source and a target. Called by each thread
+ * for its instance of the target and only deletes connections of that thread.
  * @param snode_id
  * @param target
  * @param target_thread
@@ -226,28 +250,23 @@ SPManager::disconnect( const index snode_id, Node* target, thread target_thread,
     {
       return;
     }
+    // the connection is on the thread of the source, whose instance of the
+    // device disconnects it
     if ( ( source->get_thread() != target_thread ) and ( source->has_proxies() ) )
     {
-      target_thread = source->get_thread();
-      target = kernel().node_manager.get_node_or_proxy( target->get_node_id(), target_thread );
+      return;
     }
 
     kernel().connection_manager.disconnect( target_thread, syn_id, snode_id, target->get_node_id() );
   }
-  else // globally receiving devices iterate over all target threads
+  else // globally receiving devices, each thread disconnects its instance
   {
     // we do not allow to connect a device to a global receiver at the moment
     if ( not source->has_proxies() )
     {
       return;
     }
-    const thread n_threads = kernel().vp_manager.get_num_threads();
-    for ( thread t = 0; t < n_threads; t++ )
-    {
-      target = kernel().node_manager.get_node_or_proxy( target->get_node_id(), t );
-      target_thread = target->get_thread();
-      kernel().connection_manager.disconnect( target_thread, syn_id, snode_id, target->get_node_id() );
-    }
+    kernel().connection_manager.disconnect( target_thread, syn_id, snode_id, target->get_node_id() );
   }
 }
 
@@ -329,11 +348,11 @@ SPManager::disconnect( NodeCollectionPTR sources,
 }
 
 void
-SPManager::update_structural_plasticity()
+SPManager::update_structural_plasticity( const thread tid )
 {
   for ( std::vector< SPBuilder* >::const_iterator i = sp_conn_builders_.begin(); i != sp_conn_builders_.end(); ++i )
   {
-    update_structural_plasticity( ( *i ) );
+    update_structural_plasticity( ( *i ), tid );
   }
 }
 
@@ -342,106 +361,180 @@ SPManager::update_structural_plasticity()
  * structural plasticity is enabled. Retrieves the number of available
  * synaptic elements to create new synapses. Retrieves the number of
  * deleted synaptic elements to delete already created synapses.
+ *
+ * Must be called by all threads. The synapses to delete and create are
+ * chosen by a single thread per rank, and each thread then deletes and
+ * creates the synapses of its nodes. The threads synchronize between the
+ * steps.
  * @param sp_builder The structural plasticity connection builder to use
+ * @param tid The calling thread
  */
 void
-SPManager::update_structural_plasticity( SPBuilder* sp_builder )
+SPManager::update_structural_plasticity( SPBuilder* sp_builder, const thread tid )
 {
-  // Index of neurons having a vacant synaptic element
-  std::vector< index > pre_vacant_id;  // pre synaptic elements (e.g Axon)
-  std::vector< index > post_vacant_id; // postsynaptic element (e.g Den)
-  std::vector< int > pre_vacant_n;     // number of synaptic elements
-  std::vector< int > post_vacant_n;    // number of synaptic elements
+  const index synapse_model = sp_builder->get_synapse_model();
+  const std::string se_pre_name = sp_builder->get_pre_synaptic_element_name();
+  const std::string se_post_name = sp_builder->get_post_synaptic_element_name();
 
-  // Index of neuron deleting a synaptic element
-  std::vector< index > pre_deleted_id, post_deleted_id;
-  std::vector< int > pre_deleted_n, post_deleted_n;
+#pragma omp single
+  {
+    exceptions_raised_.assign( kernel().vp_manager.get_num_threads(), nullptr );
 
-  // Global vector for vacant and deleted synaptic element
-  std::vector< index > pre_vacant_id_global, post_vacant_id_global;
-  std::vector< int > pre_vacant_n_global, post_vacant_n_global;
-  std::vector< index > pre_deleted_id_global, post_deleted_id_global;
-  std::vector< int > pre_deleted_n_global, post_deleted_n_global;
+    // Index of neurons deleting a pre synaptic element (e.g. Axon)
+    std::vector< index > pre_deleted_id, pre_deleted_id_global;
+    std::vector< int > pre_deleted_n;
+    std::vector< index > pre_vacant_id;
+    std::vector< int > pre_vacant_n;
 
-  // Vector of displacements for communication
-  std::vector< int > displacements;
+    // Vector of displacements for communication
+    std::vector< int > displacements;
 
-  // Get pre synaptic elements data from global nodes
-  get_synaptic_elements(
-    sp_builder->get_pre_synaptic_element_name(), pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
+    // Get pre synaptic elements data from local nodes
+    get_synaptic_elements( se_pre_name, pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
+    sort_by_id_( pre_deleted_id, pre_deleted_n );
 
-  // Communicate the number of deleted pre-synaptic elements
-  kernel().mpi_manager.communicate( pre_deleted_id, pre_deleted_id_global, displacements );
-  kernel().mpi_manager.communicate( pre_deleted_n, pre_deleted_n_global, displacements );
+    deleted_sources_.clear();
+    deleted_targets_.clear();
+    if ( structural_plasticity_point_to_point_ )
+    {
+      // All ranks need to know the sources to look for their connections
+      kernel().mpi_manager.communicate( pre_deleted_id, pre_deleted_id_global, displacements );
+      if ( pre_deleted_id_global.size() > 0 )
+      {
+        delete_synapses_from_pre_point_to_point_(
+          pre_deleted_id_global, pre_deleted_id, pre_deleted_n, synapse_model, se_post_name );
+      }
+    }
+    else
+    {
+      // Communicate the number of deleted pre-synaptic elements
+      std::vector< int > pre_deleted_n_global;
+      kernel().mpi_manager.communicate( pre_deleted_id, pre_deleted_id_global, displacements );
+      kernel().mpi_manager.communicate( pre_deleted_n, pre_deleted_n_global, displacements );
+      sort_by_id_( pre_deleted_id_global, pre_deleted_n_global );
+      if ( pre_deleted_id_global.size() > 0 )
+      {
+        delete_synapses_from_pre( pre_deleted_id_global, pre_deleted_n_global, synapse_model, se_post_name );
+      }
+    }
+    synapses_changed_ = not deleted_sources_.empty();
+  } // of omp single, implicit barrier
 
-  if ( pre_deleted_id_global.size() > 0 )
-  {
-    delete_synapses_from_pre( pre_deleted_id_global,
-      pre_deleted_n_global,
-      sp_builder->get_synapse_model(),
-      sp_builder->get_pre_synaptic_element_name(),
-      sp_builder->get_post_synaptic_element_name() );
-    // update the number of synaptic elements
-    get_synaptic_elements(
-      sp_builder->get_pre_synaptic_element_name(), pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
-  }
-  // Get postsynaptic elements data from local nodes
-  get_synaptic_elements(
-    sp_builder->get_post_synaptic_element_name(), post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
-  // Communicate the number of deleted postsynaptic elements
-  kernel().mpi_manager.communicate( post_deleted_id, post_deleted_id_global, displacements );
-  kernel().mpi_manager.communicate( post_deleted_n, post_deleted_n_global, displacements );
+  delete_synapses_( synapse_model, se_pre_name, se_post_name, tid );
+#pragma omp barrier
 
-  if ( post_deleted_id_global.size() > 0 )
+#pragma omp single
   {
-    delete_synapses_from_post( post_deleted_id_global,
-      post_deleted_n_global,
-      sp_builder->get_synapse_model(),
-      sp_builder->get_pre_synaptic_element_name(),
-      sp_builder->get_post_synaptic_element_name() );
-    get_synaptic_elements(
-      sp_builder->get_pre_synaptic_element_name(), pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
-    get_synaptic_elements(
-      sp_builder->get_post_synaptic_element_name(), post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
-  }
+    // Index of neurons deleting a postsynaptic element (e.g. Den)
+    std::vector< index > post_deleted_id;
+    std::vector< int > post_deleted_n;
+    std::vector< index > post_vacant_id;
+    std::vector< int > post_vacant_n;
+
+    // Get postsynaptic elements data from local nodes, all their
+    // connections are local as well
+    get_synaptic_elements( se_post_name, post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
+    sort_by_id_( post_deleted_id, post_deleted_n );
+
+    deleted_sources_.clear();
+    deleted_targets_.clear();
+    if ( structural_plasticity_point_to_point_ )
+    {
+      delete_synapses_from_post_point_to_point_( post_deleted_id, post_deleted_n, synapse_model );
+    }
+    else
+    {
+      // Communicate the number of deleted postsynaptic elements
+      std::vector< index > post_deleted_id_global;
+      std::vector< int > post_deleted_n_global;
+      std::vector< int > displacements;
+      kernel().mpi_manager.communicate( post_deleted_id, post_deleted_id_global, displacements );
+      kernel().mpi_manager.communicate( post_deleted_n, post_deleted_n_global, displacements );
+      sort_by_id_( post_deleted_id_global, post_deleted_n_global );
+      if ( post_deleted_id_global.size() > 0 )
+      {
+        delete_synapses_from_post( post_deleted_id_global, post_deleted_n_global, synapse_model );
+      }
+    }
+    synapses_changed_ = synapses_changed_ or not deleted_sources_.empty();
+  } // of omp single, implicit barrier
 
-  // Communicate vacant elements
-  kernel().mpi_manager.communicate( pre_vacant_id, pre_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate( pre_vacant_n, pre_vacant_n_global, displacements );
-  kernel().mpi_manager.communicate( post_vacant_id, post_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate( post_vacant_n, post_vacant_n_global, displacements );
+  delete_synapses_( synapse_model, se_pre_name, se_post_name, tid );
+#pragma omp barrier
 
-  bool synapses_created = false;
-  if ( pre_vacant_id_global.size() > 0 and post_vacant_id_global.size() > 0 )
+#pragma omp single
   {
-    synapses_created = create_synapses(
-      pre_vacant_id_global, pre_vacant_n_global, post_vacant_id_global, post_vacant_n_global, sp_builder );
-  }
-  if ( synapses_created or post_deleted_id.size() > 0 or pre_deleted_id.size() > 0 )
+    // Index of neurons having a vacant synaptic element
+    std::vector< index > pre_vacant_id, post_vacant_id;
+    std::vector< int > pre_vacant_n, post_vacant_n;
+    std::vector< index > pre_deleted_id, post_deleted_id;
+    std::vector< int > pre_deleted_n, post_deleted_n;
+
+    get_synaptic_elements( se_pre_name, pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
+    get_synaptic_elements( se_post_name, post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
+    sort_by_id_( pre_vacant_id, pre_vacant_n );
+    sort_by_id_( post_vacant_id, post_vacant_n );
+
+    new_sources_.clear();
+    new_targets_.clear();
+    if ( structural_plasticity_point_to_point_ )
+    {
+      create_synapses_point_to_point_( pre_vacant_id, pre_vacant_n, post_vacant_id, post_vacant_n );
+    }
+    else
+    {
+      // Communicate vacant elements
+      std::vector< index > pre_vacant_id_global, post_vacant_id_global;
+      std::vector< int > pre_vacant_n_global, post_vacant_n_global;
+      std::vector< int > displacements;
+      kernel().mpi_manager.communicate( pre_vacant_id, pre_vacant_id_global, displacements );
+      kernel().mpi_manager.communicate( pre_vacant_n, pre_vacant_n_global, displacements );
+      kernel().mpi_manager.communicate( post_vacant_id, post_vacant_id_global, displacements );
+      kernel().mpi_manager.communicate( post_vacant_n, post_vacant_n_global, displacements );
+      sort_by_id_( pre_vacant_id_global, pre_vacant_n_global );
+      sort_by_id_( post_vacant_id_global, post_vacant_n_global );
+      if ( pre_vacant_id_global.size() > 0 and post_vacant_id_global.size() > 0 )
+      {
+        create_synapses( pre_vacant_id_global, pre_vacant_n_global, post_vacant_id_global, post_vacant_n_global );
+      }
+    }
+    synapses_changed_ = synapses_changed_ or not new_sources_.empty();
+  } // of omp single, implicit barrier
+
+  sp_builder->sp_connect( new_sources_, new_targets_, tid );
+#pragma omp barrier
+
+#pragma omp master
   {
-    kernel().connection_manager.set_connections_have_changed();
+    // connection tables are rebuilt only if connections have changed on any rank
+    if ( kernel().mpi_manager.any_true( synapses_changed_ ) )
+    {
+      kernel().connection_manager.set_connections_have_changed();
+    }
   }
+#pragma omp barrier
+
+  // all threads see the same exceptions and throw alike
+  check_exceptions_();
+  sp_builder->check_exceptions();
 }
 
 /**
- * Dynamic creation of synapses
+ * Chooses the synapses to create from the vacant synaptic elements and
+ * stores them in new_sources_ and new_targets_.
  * @param pre_id source id
  * @param pre_n number of available synaptic elements in the pre node
  * @param post_id target id
  * @param post_n number of available synaptic elements in the post node
- * @param sp_conn_builder structural plasticity connection builder to use
- *
- * @return true if synapses are created
  */
-bool
+void
 SPManager::create_synapses( std::vector< index >& pre_id,
   std::vector< int >& pre_n,
   std::vector< index >& post_id,
-  std::vector< int >& post_n,
-  SPBuilder* sp_conn_builder )
+  std::vector< int >& post_n )
 {
-  std::vector< index > pre_id_rnd;
-  std::vector< index > post_id_rnd;
+  std::vector< index >& pre_id_rnd = new_sources_;
+  std::vector< index >& post_id_rnd = new_targets_;
 
   // shuffle the vacant element
   serialize_id( pre_id, pre_n, pre_id_rnd );
@@ -462,28 +555,22 @@ SPManager::create_synapses( std::vector< index >& pre_id,
     global_shuffle( post_id_rnd, pre_id_rnd.size() );
     post_id_rnd.resize( pre_id_rnd.size() );
   }
-
-  // create synapse
-  sp_conn_builder->sp_connect( pre_id_rnd, post_id_rnd );
-
-  return not pre_id_rnd.empty();
 }
 
 /**
  * Deletion of synapses due to the loss of a pre synaptic element. The
  * corresponding pre synaptic element will still remain available for a new
- * connection on the following updates in connectivity
+ * connection on the following updates in connectivity. The synapses to delete
+ * are appended to deleted_sources_ and deleted_targets_.
  * @param pre_deleted_id Id of the node with the deleted pre synaptic element
  * @param pre_deleted_n number of deleted pre synaptic elements
  * @param synapse_model model name
- * @param se_pre_name pre synaptic element name
  * @param se_post_name postsynaptic element name
  */
 void
 SPManager::delete_synapses_from_pre( const std::vector< index >& pre_deleted_id,
   std::vector< int >& pre_deleted_n,
   const index synapse_model,
-  const std::string& se_pre_name,
   const std::string& se_post_name )
 {
   /*
@@ -508,8 +595,9 @@ SPManager::delete_synapses_from_pre( const std::vector< index >& pre_deleted_id,
   connectivity_it = connectivity.begin();
   for ( ; id_it != pre_deleted_id.end() and n_it != pre_deleted_n.end(); id_it++, n_it++, connectivity_it++ )
   {
-    // Communicate the list of targets
+    // Communicate the list of targets, ordered independent of threads and ranks
     kernel().mpi_manager.communicate( *connectivity_it, global_targets, displacements );
+    std::sort( global_targets.begin(), global_targets.end() );
     // shuffle only the first n items, n is the number of deleted synaptic
     // elements
     if ( -( *n_it ) > static_cast< int >( global_targets.size() ) )
@@ -520,31 +608,169 @@ SPManager::delete_synapses_from_pre( const std::vector< index >& pre_deleted_id,
 
     for ( int i = 0; i < -( *n_it ); ++i ) // n is negative
     {
-      delete_synapse( *id_it, global_targets[ i ], synapse_model, se_pre_name, se_post_name );
+      deleted_sources_.push_back( *id_it );
+      deleted_targets_.push_back( global_targets[ i ] );
+    }
+  }
+}
+
+/**
+ * Chooses the synapses to create from the vacant synaptic elements of the
+ * local nodes and stores those with source or target on this rank in
+ * new_sources_ and new_targets_. Each vacant element is sent to an owner
+ * rank drawn at random, which matches the elements it receives at random.
+ * @param pre_id source id
+ * @param pre_n number of available synaptic elements in the pre node
+ * @param post_id target id
+ * @param post_n number of available synaptic elements in the post node
+ */
+void
+SPManager::create_synapses_point_to_point_( std::vector< index >& pre_id,
+  std::vector< int >& pre_n,
+  std::vector< index >& post_id,
+  std::vector< int >& post_n )
+{
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  RngPtr rng = kernel().random_manager.get_rank_specific_rng();
+
+  // send each vacant element to its owner rank
+  std::vector< index > pre_elements;
+  std::vector< index > post_elements;
+  serialize_id( pre_id, pre_n, pre_elements );
+  serialize_id( post_id, post_n, post_elements );
+
+  std::vector< std::vector< index > > pre_send_buffers( num_processes );
+  std::vector< std::vector< index > > post_send_buffers( num_processes );
+  for ( const index node_id : pre_elements )
+  {
+    pre_send_buffers[ num_processes > 1 ? rng->ulrand( num_processes ) : 0 ].push_back( node_id );
+  }
+  for ( const index node_id : post_elements )
+  {
+    post_send_buffers[ num_processes > 1 ? rng->ulrand( num_processes ) : 0 ].push_back( node_id );
+  }
+  exchange_( pre_send_buffers, pre_elements );
+  exchange_( post_send_buffers, post_elements );
+
+  // Shuffle only the largest vector, we only draw the n first items, where n
+  // is the number of elements in the other vector
+  if ( pre_elements.size() > post_elements.size() )
+  {
+    partial_shuffle( pre_elements, post_elements.size(), rng );
+  }
+  else
+  {
+    partial_shuffle( post_elements, pre_elements.size(), rng );
+  }
+
+  std::vector< std::vector< index > > send_buffers( num_processes );
+  for ( size_t i = 0; i < pre_elements.size(); ++i )
+  {
+    add_synapse_to_send_buffers_( pre_elements[ i ], post_elements[ i ], send_buffers );
+  }
+  exchange_synapses_( send_buffers, new_sources_, new_targets_ );
+}
+
+/**
+ * Deletion of synapses due to the loss of a pre synaptic element. The
+ * corresponding postsynaptic element will still remain available for a new
+ * connection on the following updates in connectivity. Each rank sends the
+ * local targets of the sources to the ranks of the sources, which choose
+ * the synapses to delete. The synapses to delete with source or target on
+ * this rank are appended to deleted_sources_ and deleted_targets_.
+ * @param pre_deleted_id_global Id of the nodes with deleted pre synaptic
+ * elements on all ranks
+ * @param pre_deleted_id Id of the local nodes with deleted pre synaptic
+ * elements, ordered by id
+ * @param pre_deleted_n number of deleted pre synaptic elements of the local
+ * nodes
+ * @param synapse_model model name
+ * @param se_post_name postsynaptic element name
+ */
+void
+SPManager::delete_synapses_from_pre_point_to_point_( const std::vector< index >& pre_deleted_id_global,
+  const std::vector< index >& pre_deleted_id,
+  const std::vector< int >& pre_deleted_n,
+  const index synapse_model,
+  const std::string& se_post_name )
+{
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+
+  // Connectivity
+  std::vector< std::vector< index > > connectivity;
+  kernel().connection_manager.get_targets( pre_deleted_id_global, synapse_model, se_post_name, connectivity );
+
+  // send the local targets of each source to the rank of the source
+  std::vector< std::vector< index > > send_buffers( num_processes );
+  for ( size_t i = 0; i < pre_deleted_id_global.size(); ++i )
+  {
+    std::vector< index >& send_buffer =
+      send_buffers[ kernel().mpi_manager.get_process_id_of_node_id( pre_deleted_id_global[ i ] ) ];
+    for ( const index target : connectivity[ i ] )
+    {
+      send_buffer.push_back( pre_deleted_id_global[ i ] );
+      send_buffer.push_back( target );
+    }
+  }
+
+  std::vector< index > sources;
+  std::vector< index > targets;
+  exchange_synapses_( send_buffers, sources, targets );
+
+  // targets of each source, ordered independent of threads and ranks
+  std::vector< std::pair< index, index > > connections;
+  connections.reserve( sources.size() );
+  for ( size_t i = 0; i < sources.size(); ++i )
+  {
+    connections.push_back( std::make_pair( sources[ i ], targets[ i ] ) );
+  }
+  std::sort( connections.begin(), connections.end() );
+
+  RngPtr rng = kernel().random_manager.get_rank_specific_rng();
+  std::vector< std::vector< index > > deleted_send_buffers( num_processes );
+  std::vector< index > global_targets;
+  auto connection_it = connections.begin();
+  for ( size_t i = 0; i < pre_deleted_id.size(); ++i )
+  {
+    global_targets.clear();
+    for ( ; connection_it != connections.end() and connection_it->first == pre_deleted_id[ i ]; ++connection_it )
+    {
+      global_targets.push_back( connection_it->second );
+    }
+
+    // draw only the first n items, n is the number of deleted synaptic
+    // elements (n is negative)
+    partial_shuffle( global_targets, std::min( static_cast< size_t >( -pre_deleted_n[ i ] ), global_targets.size() ), rng );
+
+    for ( const index target : global_targets )
+    {
+      add_synapse_to_send_buffers_( pre_deleted_id[ i ], target, deleted_send_buffers );
     }
   }
+
+  exchange_synapses_( deleted_send_buffers, deleted_sources_, deleted_targets_ );
 }
 
 /**
  * Handles the deletion of synapses between source and target nodes. The
  * deletion is defined by the pre and postsynaptic elements and the synapse
  * type. Updates the number of connected synaptic elements in the source and
- * target.
+ * target. Only the source and target on the given thread are updated.
  * @param snode_id source id
  * @param tnode_id target id
  * @param syn_id synapse type
  * @param se_pre_name name of the pre synaptic element
  * @param se_post_name name of the postsynaptic element
+ * @param tid thread to delete the synapse on
  */
 void
 SPManager::delete_synapse( const index snode_id,
   const index tnode_id,
   const long syn_id,
-  const std::string se_pre_name,
-  const std::string se_post_name )
+  const std::string& se_pre_name,
+  const std::string& se_post_name,
+  const thread tid )
 {
-  // get thread id
-  const int tid = kernel().vp_manager.get_thread_id();
   if ( kernel().node_manager.is_local_node_id( snode_id ) )
   {
     Node* const source = kernel().node_manager.get_node_or_proxy( snode_id );
@@ -571,19 +797,16 @@ SPManager::delete_synapse( const index snode_id,
 /**
  * Deletion of synapses due to the loss of a postsynaptic element. The
  * corresponding pre synaptic element will still remain available for a new
- * connection on the following updates in connectivity
+ * connection on the following updates in connectivity. The synapses to delete
+ * are appended to deleted_sources_ and deleted_targets_.
  * @param post_deleted_id Id of the node with the deleted postsynaptic element
  * @param post_deleted_n number of deleted postsynaptic elements
  * @param synapse_model model name
- * @param se_pre_name pre synaptic element name
- * @param se_post_name postsynaptic element name
  */
 void
 SPManager::delete_synapses_from_post( std::vector< index >& post_deleted_id,
   std::vector< int >& post_deleted_n,
-  index synapse_model,
-  std::string se_pre_name,
-  std::string se_post_name )
+  index synapse_model )
 {
   /*
    * TODO: Synapses deletion due to the loss of a postsynaptic element can
@@ -610,8 +833,9 @@ SPManager::delete_synapses_from_post( std::vector< index >& post_deleted_id,
 
   for ( ; id_it != post_deleted_id.end() and n_it != post_deleted_n.end(); id_it++, n_it++, connectivity_it++ )
   {
-    // Communicate the list of sources
+    // Communicate the list of sources, ordered independent of threads and ranks
     kernel().mpi_manager.communicate( *connectivity_it, global_sources, displacements );
+    std::sort( global_sources.begin(), global_sources.end() );
     // shuffle only the first n items, n is the number of deleted synaptic
     // elements
     if ( -( *n_it ) > static_cast< int >( global_sources.size() ) )
@@ -622,11 +846,58 @@ SPManager::delete_synapses_from_post( std::vector< index >& post_deleted_id,
 
     for ( int i = 0; i < -( *n_it ); i++ ) // n is negative
     {
-      delete_synapse( global_sources[ i ], *id_it, synapse_model, se_pre_name, se_post_name );
+      deleted_sources_.push_back( global_sources[ i ] );
+      deleted_targets_.push_back( *id_it );
     }
   }
 }
 
+/**
+ * Deletion of synapses due to the loss of a postsynaptic element. The
+ * corresponding pre synaptic element will still remain available for a new
+ * connection on the following updates in connectivity. All connections of
+ * the local targets are local, so the synapses to delete are chosen
+ * locally and only sent to the ranks of their sources. The synapses to
+ * delete with source or target on this rank are appended to
+ * deleted_sources_ and deleted_targets_.
+ * @param post_deleted_id Id of the local nodes with deleted postsynaptic
+ * elements
+ * @param post_deleted_n number of deleted postsynaptic elements
+ * @param synapse_model model name
+ */
+void
+SPManager::delete_synapses_from_post_point_to_point_( std::vector< index >& post_deleted_id,
+  std::vector< int >& post_deleted_n,
+  index synapse_model )
+{
+  // Connectivity
+  std::vector< std::vector< index > > connectivity;
+
+  // Retrieve the connected sources
+  kernel().connection_manager.get_sources( post_deleted_id, synapse_model, connectivity );
+
+  RngPtr rng = kernel().random_manager.get_rank_specific_rng();
+  std::vector< std::vector< index > > send_buffers( kernel().mpi_manager.get_num_processes() );
+  for ( size_t i = 0; i < post_deleted_id.size(); ++i )
+  {
+    // sources ordered independent of threads
+    std::vector< index >& global_sources = connectivity[ i ];
+    std::sort( global_sources.begin(), global_sources.end() );
+
+    // draw only the first n items, n is the number of deleted synaptic
+    // elements (n is negative)
+    partial_shuffle(
+      global_sources, std::min( static_cast< size_t >( -post_deleted_n[ i ] ), global_sources.size() ), rng );
+
+    for ( const index source : global_sources )
+    {
+      add_synapse_to_send_buffers_( source, post_deleted_id[ i ], send_buffers );
+    }
+  }
+
+  exchange_synapses_( send_buffers, deleted_sources_, deleted_targets_ );
+}
+
 void
 nest::SPManager::get_synaptic_elements( std::string se_name,
   std::vector< index >& se_vacant_id,
@@ -708,6 +979,58 @@ nest::SPManager::serialize_id( std::vector< index >& id, std::vector< int >& n,
   }
 }
 
+void
+nest::SPManager::delete_synapses_( const index syn_id,
+  const std::string& se_pre_name,
+  const std::string& se_post_name,
+  const thread tid )
+{
+  try
+  {
+    for ( size_t i = 0; i < deleted_sources_.size(); ++i )
+    {
+      delete_synapse( deleted_sources_[ i ], deleted_targets_[ i ], syn_id, se_pre_name, se_post_name, tid );
+    }
+  }
+  catch ( std::exception& err )
+  {
+    // We must create a new exception here, err's lifetime ends at
+    // the end of the catch block.
+    exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+  }
+}
+
+void
+nest::SPManager::check_exceptions_() const
+{
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    if ( exceptions_raised_.at( tid ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised_.at( tid ) ) );
+    }
+  }
+}
+
+void
+nest::SPManager::sort_by_id_( std::vector< index >& id, std::vector< int >& n )
+{
+  // order of nodes from all threads and ranks, independent of their number
+  std::vector< std::pair< index, int > > id_n;
+  id_n.reserve( id.size() );
+  for ( size_t i = 0; i < id.size(); ++i )
+  {
+    id_n.push_back( std::make_pair( id[ i ], n[ i ] ) );
+  }
+  std::sort( id_n.begin(), id_n.end() );
+
+  for ( size_t i = 0; i < id_n.size(); ++i )
+  {
+    id[ i ] = id_n[ i ].first;
+    n[ i ] = id_n[ i ].second;
+  }
+}
+
 void
 nest::SPManager::global_shuffle( std::vector< index >& v )
 {
@@ -719,25 +1042,71 @@ nest::SPManager::global_shuffle( std::vector< index >& v )
  */
 void
 nest::SPManager::global_shuffle( std::vector< index >& v, size_t n )
+{
+  // shuffle using the global random number generator
+  partial_shuffle( v, n, get_rank_synced_rng() );
+}
+
+void
+nest::SPManager::exchange_( std::vector< std::vector< index > >& send_buffers, std::vector< index >& recv_buffer )
+{
+  std::vector< index > send_buffer;
+  std::vector< int > send_counts;
+  for ( const std::vector< index >& buffer : send_buffers )
+  {
+    send_buffer.insert( send_buffer.end(), buffer.begin(), buffer.end() );
+    send_counts.push_back( buffer.size() );
+  }
+
+  kernel().mpi_manager.communicate_Alltoallv( send_buffer, send_counts, recv_buffer );
+}
+
+void
+nest::SPManager::exchange_synapses_( std::vector< std::vector< index > >& send_buffers,
+  std::vector< index >& sources,
+  std::vector< index >& targets )
+{
+  std::vector< index > recv_buffer;
+  exchange_( send_buffers, recv_buffer );
+
+  assert( recv_buffer.size() % 2 == 0 );
+  for ( size_t i = 0; i < recv_buffer.size(); i += 2 )
+  {
+    sources.push_back( recv_buffer[ i ] );
+    targets.push_back( recv_buffer[ i + 1 ] );
+  }
+}
+
+void
+nest::SPManager::add_synapse_to_send_buffers_( const index source,
+  const index target,
+  std::vector< std::vector< index > >& send_buffers ) const
+{
+  const thread source_rank = kernel().mpi_manager.get_process_id_of_node_id( source );
+  const thread target_rank = kernel().mpi_manager.get_process_id_of_node_id( target );
+
+  send_buffers[ source_rank ].push_back( source );
+  send_buffers[ source_rank ].push_back( target );
+  if ( target_rank != source_rank )
+  {
+    send_buffers[ target_rank ].push_back( source );
+    send_buffers[ target_rank ].push_back( target );
+  }
+}
+
+void
+nest::SPManager::partial_shuffle( std::vector< index >& v, size_t n, RngPtr rng )
 {
   assert( n <= v.size() );
 
-  // shuffle res using the global random number generator
-  unsigned int N = v.size();
-  std::vector< index > v2;
-  index tmp;
-  unsigned int rnd;
-  std::vector< index >::iterator rndi;
-  for ( unsigned int i = 0; i < n; i++ )
+  const size_t N = v.size();
+  for ( size_t i = 0; i < n; ++i )
   {
-    N = v.size();
-    rnd = get_rank_synced_rng()->ulrand( N );
-    tmp = v[ rnd ];
-    v2.push_back( tmp );
-    rndi = v.begin();
-    v.erase( rndi + rnd );
+    // draw from the items not drawn yet, which are kept behind the drawn ones
+    const size_t rnd = i + rng->ulrand( N - i );
+    std::swap( v[ i ], v[ rnd ] );
   }
-  v = v2;
+  v.resize( n );
 }
 
 
@@ -747,10 +1116,6 @@ nest::SPManager::global_shuffle( std::vector< index >& v, size_t n )
 void
 nest::SPManager::enable_structural_plasticity()
 {
-  if ( kernel().vp_manager.get_num_threads() > 1 )
-  {
-    throw KernelException( "Structural plasticity can not be used with multiple threads" );
-  }
   if ( not kernel().connection_manager.get_keep_source_table() )
   {
     throw KernelException(
@@ -31,6 +31,7 @@
 #define SP_MANAGER_H
 
 // C++ includes:
+#include <memory>
 #include <vector>
 
 // Includes from libnestutil:
@@ -41,11 +42,13 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node_collection.h"
+#include "random_generators.h"
 
 // Includes from sli:
 #include "arraydatum.h"
 #include "dict.h"
 #include "dictdatum.h"
+#include "sliexceptions.h"
 
 namespace nest
 {
@@ -69,6 +72,7 @@ public:
   virtual void initialize();
   virtual void finalize();
 
+  virtual void change_number_of_threads() override;
   virtual void get_status( DictionaryDatum& );
   virtual void set_status( const DictionaryDatum& );
 
@@ -109,8 +113,27 @@ public:
    */
   void disconnect( const index snode_id, Node* target, thread target_thread, const index syn_id );
 
-  void update_structural_plasticity();
-  void update_structural_plasticity( SPBuilder* );
+  /**
+   * Create and delete synapses according to the synaptic elements of all
+   * nodes. Must be called by all threads.
+   *
+   * The synapses to create and delete are chosen by one thread per rank
+   * from the synaptic elements and connections of all threads and ranks,
+   * ordered by node ID, so that the choice does not depend on the
+   * distribution of the nodes. Each thread then creates and deletes the
+   * synapses of its nodes.
+   *
+   * With the kernel property structural_plasticity_point_to_point, ranks
+   * only exchange the synaptic element changes and synapses that involve
+   * their nodes, point to point: connections of a source that lost
+   * pre-synaptic elements are chosen by the rank of the source, connections
+   * of a target that lost postsynaptic elements by the rank of the target,
+   * and vacant elements are matched on owner ranks drawn at random. The
+   * choice then depends on the number of ranks, but not on the number of
+   * threads.
+   */
+  void update_structural_plasticity( const thread tid );
+  void update_structural_plasticity( SPBuilder*, const thread tid );
 
   /**
    * Enable structural plasticity
@@ -144,26 +167,26 @@ public:
    */
   delay builder_max_delay() const;
 
-  // Creation of synapses
-  bool create_synapses( std::vector< index >& pre_vacant_id,
+  // Choice of synapses to create
+  void create_synapses( std::vector< index >& pre_vacant_id,
     std::vector< int >& pre_vacant_n,
     std::vector< index >& post_vacant_id,
-    std::vector< int >& post_vacant_n,
-    SPBuilder* sp_conn_builder );
-  // Deletion of synapses on the pre synaptic side
+    std::vector< int >& post_vacant_n );
+  // Choice of synapses to delete on the pre synaptic side
   void delete_synapses_from_pre( const std::vector< index >& pre_deleted_id,
     std::vector< int >& pre_deleted_n,
     const index synapse_model,
-    const std::string& se_pre_name,
     const std::string& se_post_name );
-  // Deletion of synapses on the postsynaptic side
-  void delete_synapses_from_post( std::vector< index >& post_deleted_id,
-    std::vector< int >& post_deleted_n,
-    index synapse_model,
-    std::string se_pre_name,
-    std::string se_post_name );
-  // Deletion of synapses
-  void delete_synapse( index source, index target, long syn_id, std::string se_pre_name, std::string se_post_name );
+  // Choice of synapses to delete on the postsynaptic side
+  void
+  delete_synapses_from_post( std::vector< index >& post_deleted_id, std::vector< int >& post_deleted_n, index synapse_model );
+  // Deletion of synapses on a thread
+  void delete_synapse( const index source,
+    const index target,
+    const long syn_id,
+    const std::string& se_pre_name,
+    const std::string& se_post_name,
+    const thread tid );
 
   void get_synaptic_elements( std::string se_name,
     std::vector< index >& se_vacant_id,
@@ -175,7 +198,77 @@ public:
   void global_shuffle( std::vector< index >& v );
   void global_shuffle( std::vector< index >& v, size_t n );
 
+  /**
+   * Replace v by n of its items drawn at random without replacement, in the
+   * order drawn. Uses a partial Fisher-Yates shuffle, which takes n draws
+   * from rng and O(n) time.
+   */
+  static void partial_shuffle( std::vector< index >& v, size_t n, RngPtr rng );
+
+  /**
+   * Scratch buffer for the calcium trace that
+   * StructuralPlasticityNode::update_synaptic_elements() computes for the
+   * nodes of thread tid.
+   */
+  std::vector< double >& get_calcium_trace_buffer( const thread tid );
+
+  /**
+   * Scratch buffer for the growth of synaptic elements in each step of the
+   * calcium trace, see GrowthCurve::update().
+   */
+  std::vector< double >& get_growth_buffer( const thread tid );
+
 private:
+  //! Choice of synapses to create with point to point exchange
+  void create_synapses_point_to_point_( std::vector< index >& pre_vacant_id,
+    std::vector< int >& pre_vacant_n,
+    std::vector< index >& post_vacant_id,
+    std::vector< int >& post_vacant_n );
+  //! Choice of synapses to delete on the pre synaptic side with point to point exchange
+  void delete_synapses_from_pre_point_to_point_( const std::vector< index >& pre_deleted_id_global,
+    const std::vector< index >& pre_deleted_id,
+    const std::vector< int >& pre_deleted_n,
+    const index synapse_model,
+    const std::string& se_post_name );
+  //! Choice of synapses to delete on the postsynaptic side with point to point exchange
+  void delete_synapses_from_post_point_to_point_( std::vector< index >& post_deleted_id,
+    std::vector< int >& post_deleted_n,
+    index synapse_model );
+
+  /**
+   * Delete the synapses in deleted_sources_ and deleted_targets_ on thread
+   * tid and keep exceptions for check_exceptions_(). Called by all threads.
+   */
+  void delete_synapses_( const index syn_id,
+    const std::string& se_pre_name,
+    const std::string& se_post_name,
+    const thread tid );
+
+  //! Throw the first exception raised by delete_synapses_() on any thread
+  void check_exceptions_() const;
+
+  //! Sort node IDs and the corresponding numbers of synaptic elements by node ID
+  void sort_by_id_( std::vector< index >& id, std::vector< int >& n );
+
+  /**
+   * Send the node IDs in send_buffers[ r ] to rank r and store the node IDs
+   * received from all ranks in rank order in recv_buffer.
+   */
+  void exchange_( std::vector< std::vector< index > >& send_buffers, std::vector< index >& recv_buffer );
+
+  /**
+   * Append the synapses received as pairs of source and target node IDs to
+   * sources and targets.
+   */
+  void exchange_synapses_( std::vector< std::vector< index > >& send_buffers,
+    std::vector< index >& sources,
+    std::vector< index >& targets );
+
+  //! Add synapse to the send buffers of the ranks of its source and target
+  void add_synapse_to_send_buffers_( const index source,
+    const index target,
+    std::vector< std::vector< index > >& send_buffers ) const;
+
   /**
    * Time interval for structural plasticity update (creation/deletion of
    * synapses).
@@ -187,6 +280,12 @@ private:
    * Off (False).
    */
   bool structural_plasticity_enabled_;
+
+  /**
+   * Exchange synaptic element changes and synapses point to point between
+   * the ranks instead of gathering them on all ranks.
+   */
+  bool structural_plasticity_point_to_point_;
   std::vector< SPBuilder* > sp_conn_builders_;
 
   /**
@@ -195,6 +294,29 @@ private:
   std::vector< GenericGrowthCurveFactory* > growthcurve_factories_;
 
   DictionaryDatum growthcurvedict_; //!< Dictionary for growth rules.
+
+  /**
+   * Synapses chosen for deletion or creation in update_structural_plasticity(),
+   * as pairs of source and target node IDs in the same order on all threads.
+   * With point to point exchange, only those with source or target on this
+   * rank.
+   */
+  std::vector< index > deleted_sources_;
+  std::vector< index > deleted_targets_;
+  std::vector< index > new_sources_;
+  std::vector< index > new_targets_;
+
+  //! Synapses of nodes on this rank have been created or deleted in the current update
+  bool synapses_changed_;
+
+  //! Exceptions raised by the threads while deleting synapses in the current update
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_;
+
+  //! Calcium trace buffers of the threads, see get_calcium_trace_buffer()
+  std::vector< std::vector< double > > calcium_trace_buffers_;
+
+  //! Growth buffers of the threads, see get_growth_buffer()
+  std::vector< std::vector< double > > growth_buffers_;
 };
 
 inline GrowthCurve*
@@ -216,6 +338,18 @@ SPManager::get_structural_plasticity_update_interval() const
   return structural_plasticity_update_interval_;
 }
 
+inline std::vector< double >&
+SPManager::get_calcium_trace_buffer( const thread tid )
+{
+  return calcium_trace_buffers_[ tid ];
+}
+
+inline std::vector< double >&
+SPManager::get_growth_buffer( const thread tid )
+{
+  return growth_buffers_[ tid ];
+}
+
 } // namespace nest
 
 #endif /* #ifndef SP_MANAGER_H */
@@ -219,11 +219,34 @@ nest::StructuralPlasticityNode::update_synaptic_elements( double t )
 {
   assert( t >= Ca_t_ );
 
+  // Integrate the calcium concentration once for all elements whose growth
+  // curves need it step by step, in the buffers of the thread of this node
+  std::vector< double >& Ca_trace = kernel().sp_manager.get_calcium_trace_buffer( get_thread() );
+  std::vector< double >& dz = kernel().sp_manager.get_growth_buffer( get_thread() );
+  bool trace_needed = false;
+  for ( std::map< Name, SynapticElement >::const_iterator it = synaptic_elements_map_.begin();
+        it != synaptic_elements_map_.end();
+        ++it )
+  {
+    trace_needed = trace_needed or it->second.uses_calcium_trace();
+  }
+  if ( trace_needed )
+  {
+    GrowthCurve::compute_calcium_trace( t, Ca_t_, Ca_minus_, tau_Ca_, Ca_trace );
+  }
+
   for ( std::map< Name, SynapticElement >::iterator it = synaptic_elements_map_.begin();
         it != synaptic_elements_map_.end();
         ++it )
   {
-    it->second.update( t, Ca_t_, Ca_minus_, tau_Ca_ );
+    if ( it->second.uses_calcium_trace() )
+    {
+      it->second.update( t, Ca_t_, Ca_minus_, tau_Ca_, Ca_trace, dz );
+    }
+    else
+    {
+      it->second.update( t, Ca_t_, Ca_minus_, tau_Ca_ );
+    }
   }
   // Update calcium concentration
   Ca_minus_ = Ca_minus_ * std::exp( ( Ca_t_ - t ) / tau_Ca_ );
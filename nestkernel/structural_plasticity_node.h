@@ -26,6 +26,7 @@
 // C++ includes:
 #include <algorithm>
 #include <deque>
+#include <vector>
 
 // Includes from nestkernel:
 #include "nest_time.h"
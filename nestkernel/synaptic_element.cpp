@@ -156,3 +156,21 @@ nest::SynapticElement::update( double t, double t_minus, double Ca_minus, double
   z_ = growth_curve_->update( t, t_minus, Ca_minus, z_, tau_Ca, growth_rate_ );
   z_t_ = t;
 }
+
+void
+nest::SynapticElement::update( double t,
+  double t_minus,
+  double Ca_minus,
+  double tau_Ca,
+  const std::vector< double >& Ca_trace,
+  std::vector< double >& dz )
+{
+  if ( z_t_ != t_minus )
+  {
+    throw KernelException(
+      "Last update of the calcium concentration does not match the last update "
+      "of the synaptic element" );
+  }
+  z_ = growth_curve_->update( t, t_minus, Ca_minus, z_, tau_Ca, growth_rate_, Ca_trace, dz );
+  z_t_ = t;
+}
@@ -86,6 +86,7 @@
 
 // C++ includes:
 #include <cmath>
+#include <vector>
 
 // Includes from nestkernel:
 #include "growth_curve.h"
@@ -165,6 +166,27 @@ public:
    */
   void update( double t, double t_minus, double Ca_minus, double tau_Ca );
 
+  /*
+   * Same as update(), with the calcium concentration after each integration
+   * step given in Ca_trace, see GrowthCurve::compute_calcium_trace(), and dz
+   * as scratch space for the growth curve.
+   */
+  void update( double t,
+    double t_minus,
+    double Ca_minus,
+    double tau_Ca,
+    const std::vector< double >& Ca_trace,
+    std::vector< double >& dz );
+
+  /*
+   * Whether the growth curve takes the calcium concentration from a trace.
+   */
+  bool
+  uses_calcium_trace() const
+  {
+    return growth_curve_->uses_calcium_trace();
+  }
+
   /**
    * \fn double get_z_value(ArchivingNode const *a, double t) const
    * Get the number of synaptic_element at the time t (in ms)
@@ -104,6 +104,28 @@ nest::TargetTableDevices::resize_to_number_of_synapse_types()
   } // end omp parallel
 }
 
+bool
+nest::TargetTableDevices::has_connections() const
+{
+  for ( auto& table : { &target_to_devices_, &target_from_devices_ } )
+  {
+    for ( auto& thread_table : *table )
+    {
+      for ( auto& node_connectors : thread_table )
+      {
+        for ( auto& connector : node_connectors )
+        {
+          if ( connector != NULL and connector->size() > 0 )
+          {
+            return true;
+          }
+        }
+      }
+    }
+  }
+  return false;
+}
+
 void
 nest::TargetTableDevices::get_connections_to_devices_( const index requested_source_node_id,
   const index requested_target_node_id,
@@ -206,6 +206,11 @@ public:
    * Checks if the device has any connections in this thread
    */
   bool is_device_connected( thread tid, index lcid ) const;
+
+  /**
+   * Checks if there are any connections to or from devices on this rank
+   */
+  bool has_connections() const;
 };
 
 inline void
@@ -154,6 +154,13 @@ public:
    */
   void record_data( long );
 
+  //! Return true if any multimeter is connected to the node
+  bool
+  has_loggers() const
+  {
+    return not data_loggers_.empty();
+  }
+
   //! Erase all existing data
   void reset();
 
@@ -412,6 +419,13 @@ public:
    */
   void record_data( long );
 
+  //! Return true if any multimeter is connected to the node
+  bool
+  has_loggers() const
+  {
+    return not data_loggers_.empty();
+  }
+
   //! Erase all existing data
   void reset();
 
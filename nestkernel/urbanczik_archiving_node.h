@@ -23,12 +23,10 @@
 #ifndef URBANCZIK_ARCHIVING_NODE_H
 #define URBANCZIK_ARCHIVING_NODE_H
 
-// C++ includes:
-#include <deque>
-
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "histentry.h"
+#include "history_buffer.h"
 #include "nest_time.h"
 #include "nest_types.h"
 #include "synaptic_element.h"
@@ -69,15 +67,15 @@ public:
 
   /**
    * \fn void get_urbanczik_history( double t1, double t2,
-   * std::deque<Archiver::histentry>::iterator* start,
-   * std::deque<Archiver::histentry>::iterator* finish, int comp )
+   * HistoryBuffer<histentry_extended>::iterator* start,
+   * HistoryBuffer<histentry_extended>::iterator* finish, int comp )
    * Sets pointer start (finish) to the first (last) entry in urbanczik_history_[comp]
    * whose time argument is between t1 and t2
    */
   void get_urbanczik_history( double t1,
     double t2,
-    std::deque< histentry_extended >::iterator* start,
-    std::deque< histentry_extended >::iterator* finish,
+    HistoryBuffer< histentry_extended >::iterator* start,
+    HistoryBuffer< histentry_extended >::iterator* finish,
     int comp );
 
   /**
@@ -123,7 +121,7 @@ protected:
   void set_status( const DictionaryDatum& d );
 
 private:
-  std::deque< histentry_extended > urbanczik_history_[ urbanczik_parameters::NCOMP - 1 ];
+  HistoryBuffer< histentry_extended > urbanczik_history_[ urbanczik_parameters::NCOMP - 1 ];
 };
 
 template < class urbanczik_parameters >
@@ -22,6 +22,9 @@
 
 #include "urbanczik_archiving_node.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 
@@ -62,33 +65,23 @@ template < class urbanczik_parameters >
 void
 nest::UrbanczikArchivingNode< urbanczik_parameters >::get_urbanczik_history( double t1,
   double t2,
-  std::deque< histentry_extended >::iterator* start,
-  std::deque< histentry_extended >::iterator* finish,
+  HistoryBuffer< histentry_extended >::iterator* start,
+  HistoryBuffer< histentry_extended >::iterator* finish,
   int comp )
 {
-  *finish = urbanczik_history_[ comp - 1 ].end();
-  if ( urbanczik_history_[ comp - 1 ].empty() )
+  HistoryBuffer< histentry_extended >& history = urbanczik_history_[ comp - 1 ];
+
+  // To have a well defined discretization of the integral, we make sure
+  // that we exclude the entry at t1 but include the one at t2 by subtracting
+  // a small number so that t_ is never equal to t1 or t2. The entries are
+  // sorted by time, so both ends are found by bisection.
+  *start = std::partition_point(
+    history.begin(), history.end(), [ t1 ]( const histentry_extended& h ) { return h.t_ - 1.0e-6 < t1; } );
+  *finish =
+    std::partition_point( *start, history.end(), [ t2 ]( const histentry_extended& h ) { return h.t_ - 1.0e-6 < t2; } );
+  for ( HistoryBuffer< histentry_extended >::iterator runner = *start; runner != *finish; ++runner )
   {
-    *start = *finish;
-    return;
-  }
-  else
-  {
-    std::deque< histentry_extended >::iterator runner = urbanczik_history_[ comp - 1 ].begin();
-    // To have a well defined discretization of the integral, we make sure
-    // that we exclude the entry at t1 but include the one at t2 by subtracting
-    // a small number so that runner->t_ is never equal to t1 or t2.
-    while ( ( runner != urbanczik_history_[ comp - 1 ].end() ) && ( runner->t_ - 1.0e-6 < t1 ) )
-    {
-      ++runner;
-    }
-    *start = runner;
-    while ( ( runner != urbanczik_history_[ comp - 1 ].end() ) && ( runner->t_ - 1.0e-6 < t2 ) )
-    {
-      ( runner->access_counter_ )++;
-      ++runner;
-    }
-    *finish = runner;
+    ++runner->access_counter_;
   }
 }
 
@@ -108,23 +101,21 @@ nest::UrbanczikArchivingNode< urbanczik_parameters >::write_urbanczik_history( T
 
   if ( n_incoming_ )
   {
+    HistoryBuffer< histentry_extended >& history = urbanczik_history_[ comp - 1 ];
+
     // prune all entries from history which are no longer needed
     // except the penultimate one. we might still need it.
-    while ( urbanczik_history_[ comp - 1 ].size() > 1 )
+    if ( history.size() > 1 )
     {
-      if ( urbanczik_history_[ comp - 1 ].front().access_counter_ >= n_incoming_ )
-      {
-        urbanczik_history_[ comp - 1 ].pop_front();
-      }
-      else
-      {
-        break;
-      }
+      const HistoryBuffer< histentry_extended >::iterator first_needed = std::find_if( history.begin(),
+        history.end() - 1,
+        [ this ]( const histentry_extended& h ) { return h.access_counter_ < n_incoming_; } );
+      history.pop_front( first_needed - history.begin() );
     }
 
     double dPI = ( n_spikes - urbanczik_params->phi( V_W_star ) * Time::get_resolution().get_ms() )
       * urbanczik_params->h( V_W_star );
-    urbanczik_history_[ comp - 1 ].push_back( histentry_extended( t_ms, dPI, 0 ) );
+    history.push_back( histentry_extended( t_ms, dPI, 0 ) );
   }
 }
 
@@ -106,11 +106,6 @@ nest::VPManager::set_status( const DictionaryDatum& d )
 
   if ( n_threads_updated or n_vps_updated )
   {
-    if ( kernel().sp_manager.is_structural_plasticity_enabled() and ( n_threads > 1 ) )
-    {
-      throw KernelException( "Structural plasticity enabled: multithreading cannot be enabled." );
-    }
-
     std::vector< std::string > errors;
     if ( kernel().node_manager.size() > 0 )
     {
@@ -157,10 +152,6 @@ nest::VPManager::get_status( DictionaryDatum& d )
 void
 nest::VPManager::set_num_threads( nest::thread n_threads )
 {
-  if ( kernel().sp_manager.is_structural_plasticity_enabled() and ( n_threads > 1 ) )
-  {
-    throw KernelException( "Multiple threads can not be used if structural plasticity is enabled" );
-  }
   n_threads_ = n_threads;
 
 #ifdef _OPENMP
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+#
+# aeif_batched_integration.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Batched integration of AdEx neurons
+-----------------------------------
+
+This script compares the integration of ``aeif_cond_alpha`` and
+``aeif_cond_exp`` neurons by GSL with the batched integration that is used if
+the kernel property ``vectorized_update`` is set.
+
+Both use the embedded Runge-Kutta-Fehlberg 4(5) method with the same step size
+control, governed by ``gsl_error_tol``. The batched integration advances
+blocks of neurons of the same model in lockstep without calls to GSL.
+``aeif_psc_alpha``, ``aeif_psc_exp`` and ``aeif_psc_delta`` support it as
+well, except for ``aeif_psc_delta`` neurons with ``refractory_input``. These
+and the other AdEx variants are always integrated neuron by neuron with GSL.
+
+A random network of AdEx neurons driven by Poisson input is simulated with
+both integrators for several values of ``gsl_error_tol``. The script reports
+the simulation times, the number of spikes and the largest difference between
+matching spike times.
+"""
+
+import time
+
+import numpy as np
+
+import nest
+
+###############################################################################
+# Parameters of the benchmark. The spike times of the two runs are compared
+# neuron by neuron.
+
+num_neurons = 2000
+indegree = 50
+weight = 2.0
+simtime = 500.0
+tolerances = [1e-4, 1e-6, 1e-8]
+
+
+def run(model, vectorized, gsl_error_tol):
+    """Simulate the network and return the simulation time and spikes."""
+
+    nest.ResetKernel()
+    nest.set_verbosity("M_WARNING")
+    nest.SetKernelStatus({"vectorized_update": vectorized, "rng_seed": 1234})
+
+    neurons = nest.Create(model, num_neurons, params={"gsl_error_tol": gsl_error_tol})
+    noise = nest.Create("poisson_generator", params={"rate": 4000.0})
+    recorder = nest.Create("spike_recorder")
+
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": indegree},
+        {"weight": nest.random.uniform(-2.0 * weight, weight), "delay": 1.5},
+    )
+    nest.Connect(noise, neurons, syn_spec={"weight": 10.0})
+    nest.Connect(neurons, recorder)
+
+    start = time.time()
+    nest.Simulate(simtime)
+    elapsed = time.time() - start
+
+    events = recorder.events
+    return elapsed, events["senders"], events["times"]
+
+
+def spike_time_difference(spikes_a, spikes_b):
+    """Return the largest difference between matching spike times, or None
+    if the neurons do not fire the same number of spikes."""
+
+    senders_a, times_a = spikes_a
+    senders_b, times_b = spikes_b
+    max_diff = 0.0
+    for sender in np.unique(np.concatenate((senders_a, senders_b))):
+        ta = np.sort(times_a[senders_a == sender])
+        tb = np.sort(times_b[senders_b == sender])
+        if len(ta) != len(tb):
+            return None
+        if len(ta) > 0:
+            max_diff = max(max_diff, np.max(np.abs(ta - tb)))
+    return max_diff
+
+
+for model in ["aeif_cond_alpha", "aeif_cond_exp"]:
+    for tol in tolerances:
+        gsl_time, *gsl_spikes = run(model, False, tol)
+        batched_time, *batched_spikes = run(model, True, tol)
+        diff = spike_time_difference(gsl_spikes, batched_spikes)
+
+        print(f"{model}, gsl_error_tol={tol:g}")
+        print(f"  GSL:     {gsl_time:7.3f} s, {len(gsl_spikes[0])} spikes")
+        print(f"  batched: {batched_time:7.3f} s, {len(batched_spikes[0])} spikes")
+        if diff is None:
+            print("  spike counts differ between the integrators")
+        else:
+            print(f"  largest spike time difference: {diff:g} ms")
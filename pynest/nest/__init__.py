@@ -275,6 +275,42 @@ class NestModule(types.ModuleType):
         "Interpolation order of polynomial used in wfr iterations",
         default=3
     )
+    vectorized_update = KernelAttribute(
+        "bool",
+        (
+            "Whether to update neurons of models that support it in batches"
+            + " of neurons of the same model on each thread"
+        ),
+        default=False,
+    )
+    lazy_update = KernelAttribute(
+        "bool",
+        (
+            "Whether neurons of models that support it skip their update"
+            + " while they receive no input and cannot reach threshold"
+        ),
+        default=False,
+    )
+    group_nodes_by_model = KernelAttribute(
+        "bool",
+        (
+            "Whether to update the nodes on each thread ordered by model"
+            + " instead of by node ID. Changes the order in which spikes"
+            + " are sent and inputs are summed"
+        ),
+        default=False,
+    )
+    input_buffer_layout = KernelAttribute(
+        "str",
+        (
+            "Memory layout of the input buffers of nodes: 'individual'"
+            + " (one allocation per buffer), or one contiguous arena per"
+            + " thread ordered by node ('node_major') or by ring buffer"
+            + " slot ('slot_major'). Can only be changed before nodes are"
+            + " created"
+        ),
+        default="individual",
+    )
     max_num_syn_models = KernelAttribute(
         "int", "Maximal number of synapse models supported", readonly=True
     )
@@ -306,6 +342,16 @@ class NestModule(types.ModuleType):
         ),
         default=10000.0,
     )
+    structural_plasticity_point_to_point = KernelAttribute(
+        "bool",
+        (
+            "Whether ranks exchange only the synaptic elements and synapses"
+            + " of their own nodes during structural plasticity updates,"
+            + " instead of gathering them on all ranks; the synapses chosen"
+            + " then depend on the number of MPI processes"
+        ),
+        default=False,
+    )
     growth_curves = KernelAttribute(
         "list[str]",
         "The list of the available structural plasticity growth curves",
@@ -322,6 +368,26 @@ class NestModule(types.ModuleType):
         ),
         default=True,
     )
+    stdp_trace_cache = KernelAttribute(
+        "bool",
+        (
+            "Whether neurons cache the postsynaptic trace values requested by"
+            + " STDP synapses, so that synapses onto the same neuron receiving"
+            + " spikes at the same time with the same delay share them"
+        ),
+        default=False,
+    )
+    stdp_fast_exp = KernelAttribute(
+        "bool",
+        (
+            "Whether plasticity rules compute the decay of their traces with"
+            + " a vectorizable exponential function that is accurate to 2 ulp"
+            + " instead of the exponential function of the C library, and"
+            + " stdp_pl_synapse_hom takes the decay over time differences on"
+            + " the grid from a table"
+        ),
+        default=False,
+    )
     data_path = KernelAttribute(
         "str",
         "A path, where all data is written to, defaults to current directory",
@@ -150,7 +150,8 @@ def _process_spatial_projections(conn_spec, syn_spec):
     for the SLI function `ConnectLayers`.
     """
     allowed_conn_spec_keys = ['mask', 'allow_multapses', 'allow_autapses', 'rule',
-                              'indegree', 'outdegree', 'p', 'use_on_source', 'allow_oversized_mask']
+                              'indegree', 'outdegree', 'p', 'use_on_source', 'allow_oversized_mask',
+                              'partition_positions', 'alias_sampling', 'use_cell_list']
     allowed_syn_spec_keys = ['weight', 'delay', 'synapse_model', 'synapse_label', 'receptor_type']
     for key in conn_spec.keys():
         if key not in allowed_conn_spec_keys:
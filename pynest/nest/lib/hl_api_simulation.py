@@ -36,10 +36,12 @@ __all__ = [
     'EnableStructuralPlasticity',
     'GetKernelStatus',
     'Install',
+    'LoadNetwork',
     'Prepare',
     'ResetKernel',
     'Run',
     'RunManager',
+    'SaveNetwork',
     'SetKernelStatus',
     'Simulate',
 ]
@@ -172,6 +174,55 @@ def RunManager():
         Cleanup()
 
 
+@check_stack
+def SaveNetwork(prefix):
+    """Write a binary snapshot of the network.
+
+    Each rank writes its local nodes and the connections stored on each of
+    its threads to the file ``<prefix>-<rank>.nestsnap``. Nodes are stored with
+    the parameters and state variables in which they differ from the model
+    defaults. Recorded data, kernel parameters, model defaults and copied
+    models are not stored. Connections to and from devices are not supported.
+
+    Parameters
+    ----------
+    prefix : str
+        Path prefix of the snapshot files
+
+    See Also
+    --------
+    LoadNetwork
+
+    """
+
+    sps(prefix)
+    sr('SaveNetwork')
+
+
+@check_stack
+def LoadNetwork(prefix):
+    """Create the network stored in a binary snapshot.
+
+    The network must be empty. Kernel parameters, in particular the
+    resolution, model defaults and copied models must be set up as when
+    the snapshot was written. Snapshots can only be loaded by the NEST build
+    that wrote them.
+
+    Parameters
+    ----------
+    prefix : str
+        Path prefix of the snapshot files written by `SaveNetwork`
+
+    See Also
+    --------
+    SaveNetwork
+
+    """
+
+    sps(prefix)
+    sr('LoadNetwork')
+
+
 @check_stack
 def ResetKernel():
     """Reset the simulation kernel.
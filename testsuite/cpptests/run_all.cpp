@@ -25,8 +25,15 @@
 #include <boost/test/included/unit_test.hpp>
 
 // Includes from cpptests
+#include "test_alias_table.h"
+#include "test_block_rkf45.h"
 #include "test_block_vector.h"
 #include "test_enum_bitfield.h"
+#include "test_history_buffer.h"
+#include "test_numerics.h"
 #include "test_parameter.h"
+#include "test_propagator_cache.h"
+#include "test_slice_ring_buffer.h"
 #include "test_sort.h"
+#include "test_sp_manager.h"
 #include "test_target_fields.h"
@@ -0,0 +1,82 @@
+/*
+ *  test_alias_table.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_ALIAS_TABLE_H
+#define TEST_ALIAS_TABLE_H
+
+// C++ includes
+#include <cmath>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// Includes from nestkernel
+#include "alias_table.h"
+#include "random_generators.h"
+
+BOOST_AUTO_TEST_SUITE( test_alias_table )
+
+/**
+ * Tests that indices are drawn with frequencies proportional to their weights,
+ * and that indices with zero weight are never drawn.
+ */
+BOOST_AUTO_TEST_CASE( test_alias_table_frequencies )
+{
+  const std::vector< double > weights = { 0.5, 0.0, 2.0, 1.0, 0.25, 4.0, 0.0, 0.25 };
+  const double sum = 8.0;
+  const int num_draws = 800000;
+
+  const nest::AliasTable table( weights );
+  BOOST_REQUIRE_EQUAL( table.size(), weights.size() );
+
+  // We need to go via a factory to avoid compiler confusion
+  nest::RandomGeneratorFactory< std::mt19937_64 > rf;
+  nest::RngPtr rng = rf.create( { 1234567890, 23423423 } );
+
+  std::vector< int > counts( weights.size(), 0 );
+  for ( int i = 0; i < num_draws; ++i )
+  {
+    const nest::index k = table( rng );
+    BOOST_REQUIRE_LT( k, weights.size() );
+    ++counts[ k ];
+  }
+
+  for ( size_t k = 0; k < weights.size(); ++k )
+  {
+    const double expected = num_draws * weights[ k ] / sum;
+    if ( weights[ k ] == 0.0 )
+    {
+      BOOST_REQUIRE_EQUAL( counts[ k ], 0 );
+    }
+    else
+    {
+      // Allow for five standard deviations of the binomial count
+      const double p = weights[ k ] / sum;
+      BOOST_REQUIRE_LT( std::abs( counts[ k ] - expected ), 5 * std::sqrt( num_draws * p * ( 1 - p ) ) );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* TEST_ALIAS_TABLE_H */
@@ -0,0 +1,135 @@
+/*
+ *  test_block_rkf45.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_BLOCK_RKF45_H
+#define TEST_BLOCK_RKF45_H
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// Includes from libnestutil
+#include "block_rkf45.h"
+
+BOOST_AUTO_TEST_SUITE( test_block_rkf45 )
+
+/**
+ * Harmonic oscillators with one angular frequency per lane.
+ */
+struct Oscillators
+{
+  const std::vector< double >& omega;
+
+  void
+  operator()( const double* const y[], double* const f[], const size_t n ) const
+  {
+    for ( size_t l = 0; l < n; ++l )
+    {
+      f[ 0 ][ l ] = y[ 1 ][ l ];
+      f[ 1 ][ l ] = -omega[ l ] * omega[ l ] * y[ 0 ][ l ];
+    }
+  }
+};
+
+/**
+ * Tests that lanes with different dynamics and tolerances are integrated
+ * independently to the end of each interval, with errors that shrink with
+ * the tolerance.
+ */
+BOOST_AUTO_TEST_CASE( test_block_rkf45_lanes )
+{
+  const size_t n = 6;
+  const std::vector< double > omega = { 1.0, 1.0, 3.0, 3.0, 10.0, 10.0 };
+  const std::vector< double > tol = { 1e-4, 1e-8, 1e-4, 1e-8, 1e-4, 1e-8 };
+  std::vector< double > h( n, 0.01 );
+  std::vector< double > t( n );
+  std::vector< double > x( n, 1.0 );
+  std::vector< double > v( n, 0.0 );
+  double* y[ 2 ] = { &x[ 0 ], &v[ 0 ] };
+
+  const Oscillators oscillators = { omega };
+  nest::BlockRKF45< 2 > integrator( n );
+
+  const double interval = 0.1;
+  const size_t num_intervals = 50;
+  for ( size_t i = 0; i < num_intervals; ++i )
+  {
+    std::fill( t.begin(), t.end(), 0.0 );
+    bool done = false;
+    while ( not done )
+    {
+      integrator.apply( oscillators, n, interval, &t[ 0 ], &h[ 0 ], &tol[ 0 ], y );
+      done = true;
+      for ( size_t l = 0; l < n; ++l )
+      {
+        done = done and t[ l ] == interval;
+      }
+    }
+  }
+
+  const double t_end = num_intervals * interval;
+  for ( size_t l = 0; l < n; ++l )
+  {
+    const double error = std::abs( x[ l ] - std::cos( omega[ l ] * t_end ) );
+    BOOST_REQUIRE_LT( error, 1e3 * tol[ l ] );
+    if ( l % 2 == 1 )
+    {
+      // the tighter tolerance yields a smaller error and step size
+      BOOST_REQUIRE_LT( error, std::abs( x[ l - 1 ] - std::cos( omega[ l - 1 ] * t_end ) ) );
+      BOOST_REQUIRE_LT( h[ l ], h[ l - 1 ] );
+    }
+  }
+}
+
+/**
+ * Tests that lanes which start at the end of the interval are not changed.
+ */
+BOOST_AUTO_TEST_CASE( test_block_rkf45_finished_lanes )
+{
+  const size_t n = 2;
+  const std::vector< double > omega = { 2.0, 2.0 };
+  const std::vector< double > tol = { 1e-6, 1e-6 };
+  std::vector< double > h( n, 0.01 );
+  std::vector< double > t = { 0.0, 0.1 };
+  std::vector< double > x( n, 1.0 );
+  std::vector< double > v( n, 0.0 );
+  double* y[ 2 ] = { &x[ 0 ], &v[ 0 ] };
+
+  const Oscillators oscillators = { omega };
+  nest::BlockRKF45< 2 > integrator( n );
+  integrator.apply( oscillators, n, 0.1, &t[ 0 ], &h[ 0 ], &tol[ 0 ], y );
+
+  BOOST_REQUIRE_GT( t[ 0 ], 0.0 );
+  BOOST_REQUIRE_LT( x[ 0 ], 1.0 );
+  BOOST_REQUIRE_EQUAL( t[ 1 ], 0.1 );
+  BOOST_REQUIRE_EQUAL( h[ 1 ], 0.01 );
+  BOOST_REQUIRE_EQUAL( x[ 1 ], 1.0 );
+  BOOST_REQUIRE_EQUAL( v[ 1 ], 0.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* TEST_BLOCK_RKF45_H */
@@ -0,0 +1,122 @@
+/*
+ *  test_history_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef TEST_HISTORY_BUFFER_H
+#define TEST_HISTORY_BUFFER_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <algorithm>
+#include <deque>
+
+// Includes from nestkernel:
+#include "histentry.h"
+#include "history_buffer.h"
+
+namespace nest
+{
+
+BOOST_AUTO_TEST_SUITE( test_history_buffer )
+
+/**
+ * Tests that the buffer holds the same entries in the same order as a
+ * std::deque while entries are appended and removed in an irregular pattern,
+ * so that the window slides over the vector and is moved to its front.
+ */
+BOOST_AUTO_TEST_CASE( test_history_buffer_matches_deque )
+{
+  HistoryBuffer< histentry > buffer;
+  std::deque< histentry > reference;
+
+  for ( int step = 0; step < 1000; ++step )
+  {
+    const double t = 0.1 * step;
+    buffer.push_back( histentry( t, step, 2 * step, 0 ) );
+    reference.push_back( histentry( t, step, 2 * step, 0 ) );
+
+    const int num_pop = step % 7 == 0 ? 5 : step % 2;
+    for ( int i = 0; i < num_pop and not reference.empty(); ++i )
+    {
+      BOOST_REQUIRE_EQUAL( buffer.front().t_, reference.front().t_ );
+      buffer.pop_front();
+      reference.pop_front();
+    }
+
+    BOOST_REQUIRE_EQUAL( buffer.size(), reference.size() );
+    BOOST_REQUIRE_EQUAL( buffer.empty(), reference.empty() );
+    BOOST_REQUIRE_EQUAL( buffer.end() - buffer.begin(), static_cast< long >( reference.size() ) );
+    BOOST_REQUIRE( std::equal( buffer.begin(),
+      buffer.end(),
+      reference.begin(),
+      []( const histentry& a, const histentry& b ) { return a.t_ == b.t_ and a.Kminus_ == b.Kminus_; } ) );
+    if ( not reference.empty() )
+    {
+      BOOST_REQUIRE_EQUAL( buffer.back().t_, reference.back().t_ );
+      BOOST_REQUIRE_EQUAL( buffer[ reference.size() / 2 ].t_, reference[ reference.size() / 2 ].t_ );
+    }
+  }
+
+  buffer.clear();
+  BOOST_REQUIRE( buffer.empty() );
+  BOOST_REQUIRE( buffer.begin() == buffer.end() );
+}
+
+/**
+ * Tests that removing several entries at once leaves the same entries as
+ * removing them one by one.
+ */
+BOOST_AUTO_TEST_CASE( test_history_buffer_bulk_pop )
+{
+  HistoryBuffer< histentry_extended > buffer;
+  std::deque< histentry_extended > reference;
+
+  for ( int step = 0; step < 1000; ++step )
+  {
+    buffer.push_back( histentry_extended( 0.1 * step, step, 0 ) );
+    reference.push_back( histentry_extended( 0.1 * step, step, 0 ) );
+
+    if ( step % 13 == 0 )
+    {
+      const size_t num_pop = reference.size() - 1 - step % 3;
+      buffer.pop_front( num_pop );
+      reference.erase( reference.begin(), reference.begin() + num_pop );
+    }
+
+    BOOST_REQUIRE_EQUAL( buffer.size(), reference.size() );
+    BOOST_REQUIRE( std::equal( buffer.begin(),
+      buffer.end(),
+      reference.begin(),
+      []( const histentry_extended& a, const histentry_extended& b ) { return a.t_ == b.t_ and a.dw_ == b.dw_; } ) );
+  }
+
+  buffer.pop_front( buffer.size() );
+  BOOST_REQUIRE( buffer.empty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_HISTORY_BUFFER_H */
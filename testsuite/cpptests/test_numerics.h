@@ -0,0 +1,150 @@
+/*
+ *  test_numerics.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_NUMERICS_H
+#define TEST_NUMERICS_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <cmath>
+#include <limits>
+#include <random>
+
+// Includes from libnestutil:
+#include "numerics.h"
+
+namespace nest
+{
+
+/**
+ * Returns the distance between approx and exact in units in the last place
+ * of exact.
+ */
+inline double
+ulp_error( const double approx, const double exact )
+{
+  const double ulp = std::nextafter( std::abs( exact ), std::numeric_limits< double >::infinity() ) - std::abs( exact );
+  return std::abs( approx - exact ) / ulp;
+}
+
+/**
+ * Returns the largest error of fast_exp< degree > relative to std::exp on
+ * random arguments spread over the whole range and over [-1, 1].
+ */
+template < unsigned int degree >
+double
+max_fast_exp_ulp_error()
+{
+  std::mt19937_64 rng( 123 );
+  std::uniform_real_distribution< double > wide( -708.0, 709.0 );
+  std::uniform_real_distribution< double > narrow( -1.0, 1.0 );
+  double max_error = 0.0;
+  for ( int i = 0; i < 100000; ++i )
+  {
+    const double x = i % 2 == 0 ? wide( rng ) : narrow( rng );
+    max_error = std::max( max_error, ulp_error( numerics::fast_exp< degree >( x ), std::exp( x ) ) );
+  }
+  return max_error;
+}
+
+BOOST_AUTO_TEST_SUITE( test_numerics )
+
+/**
+ * Tests the documented accuracy of fast_exp for each degree.
+ */
+BOOST_AUTO_TEST_CASE( test_fast_exp_accuracy )
+{
+  BOOST_REQUIRE( max_fast_exp_ulp_error< 5 >() <= 2.0 );
+  BOOST_REQUIRE( max_fast_exp_ulp_error< 4 >() <= 16.0 );
+  BOOST_REQUIRE( max_fast_exp_ulp_error< 3 >() <= 32768.0 );
+}
+
+/**
+ * Tests fast_exp at exact values and at the ends of its range.
+ */
+BOOST_AUTO_TEST_CASE( test_fast_exp_special_values )
+{
+  const double inf = std::numeric_limits< double >::infinity();
+
+  BOOST_REQUIRE_EQUAL( numerics::fast_exp( 0.0 ), 1.0 );
+  BOOST_REQUIRE_EQUAL( numerics::fast_exp( std::log( 2.0 ) * 10 ), 1024.0 );
+  BOOST_REQUIRE_EQUAL( numerics::fast_exp( -inf ), 0.0 );
+  BOOST_REQUIRE_EQUAL( numerics::fast_exp( -800.0 ), 0.0 );
+  BOOST_REQUIRE_EQUAL( numerics::fast_exp( inf ), inf );
+  BOOST_REQUIRE_EQUAL( numerics::fast_exp( 710.0 ), inf );
+  BOOST_REQUIRE( std::isnan( numerics::fast_exp( std::numeric_limits< double >::quiet_NaN() ) ) );
+
+  // largest and smallest arguments with a normal result
+  BOOST_REQUIRE( ulp_error( numerics::fast_exp( 709.78 ), std::exp( 709.78 ) ) <= 2.0 );
+  BOOST_REQUIRE( ulp_error( numerics::fast_exp( -708.39 ), std::exp( -708.39 ) ) <= 2.0 );
+}
+
+/**
+ * Tests fast_expm1 for small arguments, where exp( x ) - 1 would cancel,
+ * and for large ones.
+ */
+BOOST_AUTO_TEST_CASE( test_fast_expm1 )
+{
+  BOOST_REQUIRE_EQUAL( numerics::fast_expm1( 0.0 ), 0.0 );
+
+  std::mt19937_64 rng( 123 );
+  std::uniform_real_distribution< double > dist( -1.0, 1.0 );
+  for ( int i = 0; i < 100000; ++i )
+  {
+    const double x = dist( rng ) * std::pow( 10.0, -( i % 10 ) );
+    BOOST_REQUIRE( ulp_error( numerics::fast_expm1( x ), std::expm1( x ) ) <= 8.0 );
+  }
+  BOOST_REQUIRE( ulp_error( numerics::fast_expm1( 20.0 ), std::expm1( 20.0 ) ) <= 2.0 );
+  BOOST_REQUIRE_EQUAL( numerics::fast_expm1( -800.0 ), -1.0 );
+}
+
+/**
+ * Tests that ExpDecayTable returns the tabulated values for time differences
+ * on the grid, computed as differences of spike times, and falls back to
+ * fast_exp off the grid and beyond the table.
+ */
+BOOST_AUTO_TEST_CASE( test_exp_decay_table )
+{
+  const double tau = 16.8;
+  const double h = 0.1;
+  numerics::ExpDecayTable table;
+  table.set( tau, h );
+
+  for ( long k = 0; k < 672; ++k )
+  {
+    const double t = ( 12345 - k ) * h - 12345 * h;
+    BOOST_REQUIRE_EQUAL( table( t ), std::exp( -( k * h ) / tau ) );
+    // t carries the rounding error of the spike times
+    BOOST_REQUIRE_CLOSE_FRACTION( table( t ), std::exp( t / tau ), 1e-13 );
+  }
+
+  BOOST_REQUIRE_EQUAL( table( -0.05 ), numerics::fast_exp( -0.05 * ( 1.0 / tau ) ) );
+  BOOST_REQUIRE_EQUAL( table( -300.0 ), numerics::fast_exp( -300.0 * ( 1.0 / tau ) ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_NUMERICS_H */
@@ -0,0 +1,111 @@
+/*
+ *  test_propagator_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_PROPAGATOR_CACHE_H
+#define TEST_PROPAGATOR_CACHE_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <cmath>
+#include <memory>
+
+// Includes from nestkernel:
+#include "propagator_cache.h"
+
+namespace nest
+{
+
+BOOST_AUTO_TEST_SUITE( test_propagator_cache )
+
+struct DecayPropagators
+{
+  explicit DecayPropagators( const double tau )
+    : P( std::exp( -Time::get_resolution().get_ms() / tau ) )
+  {
+    ++num_constructed;
+  }
+
+  double P;
+  static int num_constructed;
+};
+
+int DecayPropagators::num_constructed = 0;
+
+struct OtherPropagators
+{
+  explicit OtherPropagators( const double )
+  {
+  }
+};
+
+/**
+ * Tests that propagators are shared between equal keys on a thread and
+ * computed anew for different keys, threads and types.
+ */
+BOOST_AUTO_TEST_CASE( test_propagator_cache_sharing )
+{
+  PropagatorCache cache;
+  cache.initialize( 2 );
+  DecayPropagators::num_constructed = 0;
+
+  std::shared_ptr< const DecayPropagators > a = cache.get< DecayPropagators >( 0, { 10. }, 10. );
+  std::shared_ptr< const DecayPropagators > b = cache.get< DecayPropagators >( 0, { 10. }, 10. );
+  BOOST_REQUIRE_EQUAL( a.get(), b.get() );
+  BOOST_REQUIRE_EQUAL( DecayPropagators::num_constructed, 1 );
+  BOOST_REQUIRE_EQUAL( a->P, std::exp( -Time::get_resolution().get_ms() / 10. ) );
+
+  std::shared_ptr< const DecayPropagators > c = cache.get< DecayPropagators >( 0, { 20. }, 20. );
+  std::shared_ptr< const DecayPropagators > d = cache.get< DecayPropagators >( 1, { 10. }, 10. );
+  BOOST_REQUIRE_NE( a.get(), c.get() );
+  BOOST_REQUIRE_NE( a.get(), d.get() );
+  BOOST_REQUIRE_EQUAL( DecayPropagators::num_constructed, 3 );
+
+  std::shared_ptr< const OtherPropagators > e = cache.get< OtherPropagators >( 0, { 10. }, 10. );
+  BOOST_REQUIRE_NE( static_cast< const void* >( a.get() ), static_cast< const void* >( e.get() ) );
+}
+
+/**
+ * Tests that clearing the cache keeps propagators in use valid and
+ * computes them anew on the next request.
+ */
+BOOST_AUTO_TEST_CASE( test_propagator_cache_clear )
+{
+  PropagatorCache cache;
+  cache.initialize( 1 );
+  DecayPropagators::num_constructed = 0;
+
+  std::shared_ptr< const DecayPropagators > a = cache.get< DecayPropagators >( 0, { 10. }, 10. );
+  cache.clear( 0 );
+  BOOST_REQUIRE_EQUAL( a->P, std::exp( -Time::get_resolution().get_ms() / 10. ) );
+
+  std::shared_ptr< const DecayPropagators > b = cache.get< DecayPropagators >( 0, { 10. }, 10. );
+  BOOST_REQUIRE_NE( a.get(), b.get() );
+  BOOST_REQUIRE_EQUAL( DecayPropagators::num_constructed, 2 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_PROPAGATOR_CACHE_H */
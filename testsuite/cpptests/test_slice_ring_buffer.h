@@ -0,0 +1,159 @@
+/*
+ *  test_slice_ring_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef TEST_SLICE_RING_BUFFER_H
+#define TEST_SLICE_RING_BUFFER_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Includes from nestkernel:
+#include "slice_ring_buffer.h"
+
+namespace nest
+{
+
+BOOST_AUTO_TEST_SUITE( test_slice_ring_buffer )
+
+typedef SliceRingBuffer::SpikeInfo SpikeInfo;
+
+/**
+ * Spikes of one slice as they arrive at a neuron: num_spikes spikes with
+ * stamps in [origin + 1, origin + min_delay] and offsets on a grid, so that
+ * coinciding spikes occur.
+ */
+std::vector< SpikeInfo >
+slice_spikes( std::mt19937& rng, const size_t num_spikes, const long min_delay )
+{
+  const long origin = 1000;
+  std::uniform_int_distribution< long > stamp( origin + 1, origin + min_delay );
+  std::uniform_int_distribution< int > offset( 0, 99 );
+
+  std::vector< SpikeInfo > spikes;
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    spikes.push_back( SpikeInfo( stamp( rng ), 0.001 * offset( rng ), 1.0 + i ) );
+  }
+  return spikes;
+}
+
+bool
+same_times( const std::vector< SpikeInfo >& a, const std::vector< SpikeInfo >& b )
+{
+  return std::equal( a.begin(),
+    a.end(),
+    b.begin(),
+    []( const SpikeInfo& x, const SpikeInfo& y ) { return x.stamp_ == y.stamp_ and x.ps_offset_ == y.ps_offset_; } );
+}
+
+/**
+ * Tests that spikes are sorted in the order of std::sort and that
+ * coinciding spikes keep their order of arrival.
+ */
+BOOST_AUTO_TEST_CASE( test_sort_for_delivery )
+{
+  std::mt19937 rng( 1234 );
+  std::vector< SpikeInfo > buffer;
+  std::vector< size_t > counts;
+
+  for ( size_t num_spikes : { 0, 1, 2, 10, 100, 1000 } )
+  {
+    for ( long min_delay : { 1, 10, 100, 10000 } )
+    {
+      std::vector< SpikeInfo > spikes = slice_spikes( rng, num_spikes, min_delay );
+      std::vector< SpikeInfo > expected = spikes;
+      std::sort( expected.begin(), expected.end(), std::greater< SpikeInfo >() );
+
+      SliceRingBuffer::sort_for_delivery( spikes, buffer, counts );
+      BOOST_REQUIRE( same_times( spikes, expected ) );
+
+      // weights increase with arrival, coinciding spikes are delivered from the back
+      for ( size_t i = 1; i < spikes.size(); ++i )
+      {
+        if ( spikes[ i ].stamp_ == spikes[ i - 1 ].stamp_ and spikes[ i ].ps_offset_ == spikes[ i - 1 ].ps_offset_ )
+        {
+          BOOST_REQUIRE_LT( spikes[ i - 1 ].weight_, spikes[ i ].weight_ );
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Microbenchmark comparing sort_for_delivery() with std::sort for the
+ * spikes of a slice of 10 steps arriving at a precise spiking neuron.
+ */
+BOOST_AUTO_TEST_CASE( benchmark_sort_for_delivery )
+{
+  const long min_delay = 10;
+  const size_t num_slices = 2000;
+  std::mt19937 rng( 5678 );
+  std::vector< SpikeInfo > buffer;
+  std::vector< size_t > counts;
+
+  for ( size_t num_spikes : { 10, 100, 1000 } )
+  {
+    std::vector< std::vector< SpikeInfo > > slices;
+    for ( size_t s = 0; s < num_slices; ++s )
+    {
+      slices.push_back( slice_spikes( rng, num_spikes, min_delay ) );
+    }
+    std::vector< std::vector< SpikeInfo > > sorted = slices;
+
+    const auto start = std::chrono::steady_clock::now();
+    for ( auto& spikes : sorted )
+    {
+      std::sort( spikes.begin(), spikes.end(), std::greater< SpikeInfo >() );
+    }
+    const auto mid = std::chrono::steady_clock::now();
+    for ( auto& spikes : slices )
+    {
+      SliceRingBuffer::sort_for_delivery( spikes, buffer, counts );
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    for ( size_t s = 0; s < num_slices; ++s )
+    {
+      BOOST_REQUIRE( same_times( slices[ s ], sorted[ s ] ) );
+    }
+
+    typedef std::chrono::duration< double, std::micro > Microseconds;
+    const double std_sort_time = Microseconds( mid - start ).count() / num_slices;
+    const double bucket_sort_time = Microseconds( end - mid ).count() / num_slices;
+    BOOST_TEST_MESSAGE( num_spikes << " spikes per slice: std::sort " << std_sort_time << " us, sort_for_delivery "
+                                   << bucket_sort_time << " us per slice" );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_SLICE_RING_BUFFER_H */
@@ -0,0 +1,164 @@
+/*
+ *  test_sp_manager.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef TEST_SP_MANAGER_H
+#define TEST_SP_MANAGER_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Includes from nestkernel:
+#include "random_generators.h"
+#include "sp_manager.h"
+
+namespace nest
+{
+
+BOOST_AUTO_TEST_SUITE( test_sp_manager )
+
+/**
+ * Drawing by erasing each drawn item from the vector, as done before
+ * partial_shuffle() was introduced, for comparison.
+ */
+void
+erase_shuffle( std::vector< index >& v, size_t n, RngPtr rng )
+{
+  std::vector< index > drawn;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const size_t rnd = rng->ulrand( v.size() );
+    drawn.push_back( v[ rnd ] );
+    v.erase( v.begin() + rnd );
+  }
+  v = drawn;
+}
+
+std::vector< index >
+node_ids( const size_t N )
+{
+  std::vector< index > v( N );
+  std::iota( v.begin(), v.end(), 1 );
+  return v;
+}
+
+/**
+ * Tests that partial_shuffle() draws n distinct items of the vector and
+ * that each item is drawn first and drawn at all with equal probability.
+ */
+BOOST_AUTO_TEST_CASE( test_partial_shuffle )
+{
+  // We need to go via a factory to avoid compiler confusion
+  RandomGeneratorFactory< std::mt19937_64 > rf;
+  RngPtr rng = rf.create( { 1234567890, 23423423 } );
+
+  for ( size_t N : { 0, 1, 2, 10, 1000 } )
+  {
+    for ( size_t n : { size_t( 0 ), N / 3, N } )
+    {
+      std::vector< index > v = node_ids( N );
+      SPManager::partial_shuffle( v, n, rng );
+      BOOST_REQUIRE_EQUAL( v.size(), n );
+
+      std::sort( v.begin(), v.end() );
+      BOOST_REQUIRE( std::adjacent_find( v.begin(), v.end() ) == v.end() );
+      BOOST_REQUIRE( n == 0 or ( v.front() >= 1 and v.back() <= N ) );
+    }
+  }
+
+  const size_t N = 10;
+  const size_t n = 4;
+  const int num_draws = 200000;
+  std::vector< int > first( N, 0 );
+  std::vector< int > drawn( N, 0 );
+  for ( int i = 0; i < num_draws; ++i )
+  {
+    std::vector< index > v = node_ids( N );
+    SPManager::partial_shuffle( v, n, rng );
+    ++first[ v[ 0 ] - 1 ];
+    for ( const index id : v )
+    {
+      ++drawn[ id - 1 ];
+    }
+  }
+
+  // Allow for five standard deviations of the binomial counts
+  for ( size_t k = 0; k < N; ++k )
+  {
+    const double p_first = 1.0 / N;
+    const double p_drawn = static_cast< double >( n ) / N;
+    BOOST_REQUIRE_LT(
+      std::abs( first[ k ] - num_draws * p_first ), 5 * std::sqrt( num_draws * p_first * ( 1 - p_first ) ) );
+    BOOST_REQUIRE_LT(
+      std::abs( drawn[ k ] - num_draws * p_drawn ), 5 * std::sqrt( num_draws * p_drawn * ( 1 - p_drawn ) ) );
+  }
+}
+
+/**
+ * Microbenchmark comparing partial_shuffle() with drawing by erasing for
+ * half of N vacant synaptic elements. Drawing by erasing takes minutes for
+ * N = 10^6 and is therefore only timed for smaller N.
+ */
+BOOST_AUTO_TEST_CASE( benchmark_partial_shuffle )
+{
+  RandomGeneratorFactory< std::mt19937_64 > rf;
+  RngPtr rng = rf.create( { 42, 4711 } );
+
+  for ( size_t N : { 10000, 100000, 1000000 } )
+  {
+    const size_t n = N / 2;
+    typedef std::chrono::duration< double, std::milli > Milliseconds;
+
+    std::vector< index > v = node_ids( N );
+    const auto start = std::chrono::steady_clock::now();
+    SPManager::partial_shuffle( v, n, rng );
+    const auto end = std::chrono::steady_clock::now();
+    BOOST_REQUIRE_EQUAL( v.size(), n );
+    const double partial_shuffle_time = Milliseconds( end - start ).count();
+    BOOST_TEST_MESSAGE( N << " vacant elements, " << n << " drawn: partial_shuffle " << partial_shuffle_time << " ms" );
+
+    if ( N <= 100000 )
+    {
+      std::vector< index > w = node_ids( N );
+      const auto erase_start = std::chrono::steady_clock::now();
+      erase_shuffle( w, n, rng );
+      const auto erase_end = std::chrono::steady_clock::now();
+      BOOST_REQUIRE_EQUAL( w.size(), n );
+      const double erase_time = Milliseconds( erase_end - erase_start ).count();
+      BOOST_TEST_MESSAGE( N << " vacant elements, " << n << " drawn: erase " << erase_time << " ms" );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_SP_MANAGER_H */
@@ -211,6 +211,36 @@ class SiegertNeuronTestCase(unittest.TestCase):
         rate_prediction, rate_iaf = self.simulate_fix_input_stats(mu, sigma)
         self.assertTrue(np.isclose(rate_iaf, rate_prediction, rtol=self.rtol))
 
+    def test_InterpolatedRatePrediction(self):
+        """
+        Check that the interpolated siegert function stays within the
+        interpolation tolerance of the exact rate prediction.
+        """
+        tol = 0.01
+        theta = self.lif_params["V_th"] - self.lif_params["E_L"]
+        siegert_params = {"tau_m": self.lif_params["tau_m"],
+                          "t_ref": self.lif_params["t_ref"],
+                          "theta": theta,
+                          "V_reset": self.lif_params["V_reset"] - self.lif_params["E_L"]}
+
+        inputs = [(mu * theta, sigma * theta)
+                  for mu in [-1./3., 0., 2./3., 0.95, 1.0, 1.5]
+                  for sigma in [0.05, np.sqrt(0.1), 1.0, 1.5]]
+
+        exact = nest.Create("siegert_neuron", len(inputs), params=siegert_params)
+        interpolated = nest.Create("siegert_neuron", len(inputs),
+                                   params=dict(siegert_params, interpolation_tol=tol))
+        drive = nest.Create("siegert_neuron", 1, params={"mean": 1.0, "rate": 1.0})
+        for (mu, sigma), e, i in zip(inputs, exact, interpolated):
+            syn_dict = {"drift_factor": mu, "diffusion_factor": sigma**2,
+                        "synapse_model": "diffusion_connection"}
+            nest.Connect(drive, e + i, syn_spec=syn_dict)
+
+        nest.Simulate(50.)
+
+        self.assertEqual(interpolated[0].interpolation_tol, tol)
+        np.testing.assert_allclose(interpolated.rate, exact.rate, rtol=0., atol=tol)
+
 
 def suite():
     # makeSuite is sort of obsolete http://bugs.python.org/issue2721
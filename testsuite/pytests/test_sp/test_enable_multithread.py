@@ -25,10 +25,8 @@ import unittest
 
 __author__ = 'sdiaz'
 
-# Structural plasticity currently does not work with multiple threads.
-# An exception should be rised if structural plasticity is enabled
-# and multiple threads are set, or if multiple threads are set and
-# the enable_structural_plasticity function is called.
+# Structural plasticity can be enabled before or after multiple threads
+# are set.
 
 HAVE_OPENMP = nest.ll_api.sli_func("is_threaded")
 
@@ -44,18 +42,14 @@ class TestEnableMultithread(unittest.TestCase):
 
         nest.ResetKernel()
         nest.EnableStructuralPlasticity()
-        # Setting multiple threads when structural plasticity is enabled should
-        # throw an exception
-        with self.assertRaises(nest.kernel.NESTError):
-            nest.local_num_threads = 2
+        nest.local_num_threads = 2
+        self.assertEqual(nest.local_num_threads, 2)
 
     def test_multithread_enable(self):
         nest.ResetKernel()
         nest.local_num_threads = 2
-        # Setting multiple threads when structural plasticity is enabled should
-        # throw an exception
-        with self.assertRaises(nest.kernel.NESTError):
-            nest.EnableStructuralPlasticity()
+        nest.EnableStructuralPlasticity()
+        self.assertEqual(nest.local_num_threads, 2)
 
 
 def suite():